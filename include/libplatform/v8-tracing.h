@@ -112,6 +112,9 @@ class V8_PLATFORM_EXPORT TraceWriter {
   virtual void Flush() = 0;
 
   static TraceWriter* CreateJSONTraceWriter(std::ostream& stream);
+  // Creates a writer for a compact binary format, which is cheaper to write
+  // than JSON. tools/binary-trace-to-json.py converts it to JSON.
+  static TraceWriter* CreateBinaryTraceWriter(std::ostream& stream);
 
  private:
   // Disallow copy and assign
@@ -213,6 +213,9 @@ class V8_EXPORT CpuProfileNode {
   /** Retrieves a child node by index. */
   const CpuProfileNode* GetChild(int index) const;
 
+  /** Returns the parent node, or NULL for the root node. */
+  const CpuProfileNode* GetParent() const;
+
   /** Retrieves deopt infos for the node. */
   const std::vector<CpuProfileDeoptInfo>& GetDeoptInfos() const;
 
@@ -272,6 +275,63 @@ class V8_EXPORT CpuProfile {
   void Delete();
 };
 
+/**
+ * CpuProfileDelta contains what a continuous CPU profile collected between
+ * two calls to CpuProfiler::TakeProfileDelta: the nodes added to its call
+ * tree and the number of samples attributed to each node in that period.
+ */
+class V8_EXPORT CpuProfileDelta {
+ public:
+  /**
+   * Returns the number of nodes added to the profile since the previous
+   * delta. Nodes are ordered by id, so parents come before their children.
+   */
+  int GetNodesCount() const;
+
+  /**
+   * Retrieves an added node by index. Nodes stay valid until the profile is
+   * deleted. While the profile is being collected, only the id, the parent
+   * and the function information of a node may be queried.
+   */
+  const CpuProfileNode* GetNode(int index) const;
+
+  /** Returns the number of nodes hit by samples since the previous delta. */
+  int GetHitNodesCount() const;
+
+  /** Retrieves a hit node by index. */
+  const CpuProfileNode* GetHitNode(int index) const;
+
+  /** Returns the number of samples attributed to the hit node at index. */
+  unsigned GetHitCount(int index) const;
+
+  /**
+   * Returns the number of samples that were attributed to a caller because
+   * the node limit of the profile was reached.
+   */
+  unsigned GetTruncatedSamplesCount() const;
+
+  /**
+   * Returns the start of the period covered by the delta (in microseconds)
+   * since the starting point used by CpuProfile::GetStartTime.
+   */
+  int64_t GetStartTime() const;
+
+  /**
+   * Returns the end of the period covered by the delta (in microseconds)
+   * since the starting point used by CpuProfile::GetStartTime.
+   */
+  int64_t GetEndTime() const;
+
+  /**
+   * Returns the time (in microseconds) the profiler thread spent turning
+   * the samples of the delta into the profile.
+   */
+  int64_t GetProcessingTime() const;
+
+  /** Deletes the delta. */
+  void Delete();
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -297,6 +357,34 @@ class V8_EXPORT CpuProfiler {
    */
   void SetSamplingInterval(int us);
 
+  /**
+   * Events that can trigger CPU profile samples, see SetSamplingEvent.
+   */
+  enum SamplingEvent {
+    /** The sampling interval elapsed, the default. */
+    kSamplingInterval,
+    /** The profiled thread used a number of nanoseconds of CPU time. */
+    kCpuTime,
+    /** The profiled thread ran a number of CPU cycles. */
+    kCpuCycles,
+    /** The profiled thread missed the last level cache a number of times. */
+    kCacheMisses,
+    /** The profiled thread mispredicted a number of branches. */
+    kBranchMisses
+  };
+
+  /**
+   * Makes the profiler take a sample every |period| occurrences of |event|
+   * in the profiled thread, so that the hit counts of the profile nodes are
+   * proportional to the events in the corresponding functions. The events
+   * are counted by the kernel through perf_event_open, which is only
+   * available on Linux. Returns false, leaving the sampling unchanged, if
+   * |event| cannot be counted, e.g. without access to the hardware
+   * performance counters. The |period| is ignored for kSamplingInterval.
+   * This method must be called when there are no profiles being recorded.
+   */
+  bool SetSamplingEvent(SamplingEvent event, uint64_t period);
+
   /**
    * Starts collecting CPU profile. Title may be an empty string. It
    * is allowed to have several profiles being collected at
@@ -316,6 +404,25 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Starts collecting a continuous CPU profile, meant for always-on
+   * profiling. Unlike StartProfiling, no individual samples are recorded and
+   * the call tree is limited to |max_nodes| nodes, so the memory used by the
+   * profile stays bounded however long it is collected. A sample that would
+   * need more nodes is attributed to its deepest caller already in the tree.
+   * The collected data is retrieved periodically with TakeProfileDelta, the
+   * profile is stopped with StopProfiling.
+   */
+  void StartContinuousProfiling(Local<String> title, unsigned max_nodes);
+
+  /**
+   * Returns what the continuous profile with a given title collected since
+   * it was started or since the previous call, or NULL if no such profile is
+   * being collected. The delta must be deleted after use by calling its
+   * |Delete| method.
+   */
+  CpuProfileDelta* TakeProfileDelta(Local<String> title);
+
   /**
    * Force collection of a sample. Must be called on the VM thread.
    * Recording the forced sample does not contribute to the aggregated
@@ -415,6 +522,19 @@ class V8_EXPORT HeapGraphNode {
   /** Returns node's own size, in bytes. */
   size_t GetShallowSize() const;
 
+  /**
+   * Returns the size of the objects that would be freed together with the
+   * node, i.e. the node and all nodes it dominates, in bytes. The dominator
+   * tree of the snapshot is computed on the first call.
+   */
+  size_t GetRetainedSize() const;
+
+  /**
+   * Returns the immediate dominator of the node, or NULL for the root and
+   * for nodes that are only reachable through weak edges.
+   */
+  const HeapGraphNode* GetDominatorNode() const;
+
   /** Returns child nodes count of the node. */
   int GetChildrenCount() const;
 
@@ -553,6 +673,42 @@ class V8_EXPORT AllocationProfile {
     unsigned int count;
   };
 
+  /**
+   * Allocation and survival history of a node in the call-graph, collected
+   * with HeapProfiler::kSamplingTrackRetention. All sizes are estimated
+   * totals in bytes since sampling started, including objects that have
+   * died since.
+   */
+  struct Retention {
+    /**
+     * Size of all objects allocated by the node.
+     */
+    size_t allocated_size;
+
+    /**
+     * Size of the objects allocated directly in the old generation, e.g.
+     * because their allocation site is pretenured, or because they are large.
+     */
+    size_t pretenured_size;
+
+    /**
+     * Size of the young objects that survived at least one garbage
+     * collection.
+     */
+    size_t survived_size;
+
+    /**
+     * Size of the young objects that were promoted to the old generation.
+     */
+    size_t promoted_size;
+
+    /**
+     * Size of the young objects that were allocated with an allocation site,
+     * whose survival feeds into the pretenuring decisions of the heap.
+     */
+    size_t allocation_site_size;
+  };
+
   /**
    * Represents a node in the call-graph.
    */
@@ -603,6 +759,12 @@ class V8_EXPORT AllocationProfile {
      * List of self allocations done by this node in the call-graph.
      */
     std::vector<Allocation> allocations;
+
+    /**
+     * Allocation history of this node. All zero unless sampling was started
+     * with HeapProfiler::kSamplingTrackRetention.
+     */
+    Retention retention;
   };
 
   /**
@@ -628,6 +790,7 @@ class V8_EXPORT HeapProfiler {
   enum SamplingFlags {
     kSamplingNoFlags = 0,
     kSamplingForceGC = 1 << 0,
+    kSamplingTrackRetention = 1 << 1,
   };
 
   /**
@@ -693,6 +856,20 @@ class V8_EXPORT HeapProfiler {
       ActivityControl* control = NULL,
       ObjectNameResolver* global_object_name_resolver = NULL);
 
+  /**
+   * Takes a heap snapshot and writes it to |stream| in a compact binary
+   * format while the heap is being walked, without keeping the snapshot in
+   * memory. Unlike with TakeHeapSnapshot, the extra memory needed does not
+   * grow with the number of references between objects. The chunks passed
+   * to OutputStream::WriteAsciiChunk contain binary data, which
+   * tools/heap-snapshot-to-json.py converts to the JSON format produced by
+   * HeapSnapshot::Serialize. Allocation traces are not included.
+   * Returns false if the snapshot was aborted by |control| or |stream|.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream, ActivityControl* control = NULL,
+      ObjectNameResolver* global_object_name_resolver = NULL);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
@@ -752,6 +929,11 @@ class V8_EXPORT HeapProfiler {
    * Objects allocated before the sampling is started will not be included in
    * the profile.
    *
+   * With kSamplingTrackRetention, the profiler also keeps the allocation
+   * history of every call-graph node, see AllocationProfile::Retention. It
+   * checks the sampled objects at every garbage collection, which tells the
+   * sites that dominate scavenge cost and promotion volume.
+   *
    * Returns false if a sampling heap profiler is already running.
    */
   bool StartSamplingHeapProfiler(uint64_t sample_interval = 512 * 1024,
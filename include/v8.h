@@ -5686,6 +5686,14 @@ class V8_EXPORT ResourceConstraints {
   void set_max_zone_pool_size(const size_t bytes) {
     max_zone_pool_size_ = bytes;
   }
+  int stub_cache_size() const { return stub_cache_size_; }
+  /**
+   * Sets the initial number of entries of the caches used by megamorphic
+   * property loads and stores. The value is rounded up to a power of two,
+   * and the caches may still grow if they miss frequently. Zero selects the
+   * default size.
+   */
+  void set_stub_cache_size(int entries) { stub_cache_size_ = entries; }
 
  private:
   int max_semi_space_size_;
@@ -5694,6 +5702,7 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   size_t code_range_size_;
   size_t max_zone_pool_size_;
+  int stub_cache_size_;
 };
 
 
@@ -5958,6 +5967,16 @@ class V8_EXPORT HeapStatistics {
   size_t malloced_memory() { return malloced_memory_; }
   size_t peak_malloced_memory() { return peak_malloced_memory_; }
   size_t does_zap_garbage() { return does_zap_garbage_; }
+  /**
+   * Bytes allocated per millisecond of mutator time in the last few
+   * seconds, or 0 if nothing was measured yet.
+   */
+  size_t allocation_rate() { return allocation_rate_; }
+  /**
+   * Bytes promoted to the old generation per millisecond of mutator time in
+   * the last few seconds, or 0 if nothing was measured yet.
+   */
+  size_t promotion_rate() { return promotion_rate_; }
 
  private:
   size_t total_heap_size_;
@@ -5969,6 +5988,8 @@ class V8_EXPORT HeapStatistics {
   size_t malloced_memory_;
   size_t peak_malloced_memory_;
   bool does_zap_garbage_;
+  size_t allocation_rate_;
+  size_t promotion_rate_;
 
   friend class V8;
   friend class Isolate;
@@ -6025,6 +6046,200 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Pause time statistics of a phase of the garbage collector, or of whole
+ * garbage collection pauses of one kind, see Isolate::GetGCPauseStatistics.
+ * Times are in microseconds. Phases nest, the time of a phase includes that
+ * of the phases it contains. Percentiles are accurate to within 1/8 of their
+ * value.
+ */
+class V8_EXPORT GCPauseStatistics {
+ public:
+  GCPauseStatistics();
+  const char* scope_name() { return scope_name_; }
+  size_t pause_count() { return pause_count_; }
+  size_t total_time() { return total_time_; }
+  size_t median_time() { return median_time_; }
+  size_t p90_time() { return p90_time_; }
+  size_t p99_time() { return p99_time_; }
+  size_t max_time() { return max_time_; }
+
+ private:
+  const char* scope_name_;
+  size_t pause_count_;
+  size_t total_time_;
+  size_t median_time_;
+  size_t p90_time_;
+  size_t p99_time_;
+  size_t max_time_;
+
+  friend class Isolate;
+};
+
+/**
+ * The breakdown of a garbage collection pause, see
+ * Isolate::SetGCPauseCallback. Times are in microseconds.
+ */
+struct GCPauseInfo {
+  GCType type;
+  size_t pause_time;
+  /**
+   * The time spent in each scope during the pause, indexed like
+   * Isolate::GetGCPauseStatistics. Scopes that did not run are 0. The
+   * incremental marking scopes hold the time of the marking steps that
+   * preceded a mark-compact, which are not part of its pause.
+   */
+  const size_t* scope_times;
+  size_t scope_count;
+  size_t promoted_bytes;
+};
+
+typedef void (*GCPauseCallback)(Isolate* isolate, const GCPauseInfo& info,
+                                void* data);
+
+/**
+ * Latency statistics of a runtime function, builtin or API function, see
+ * Isolate::SetRuntimeCallStatsSamplingInterval. Times are in microseconds
+ * and only include the time spent in the function itself, not in nested
+ * runtime calls. Percentiles are accurate to within 1/8 of their value.
+ */
+class V8_EXPORT RuntimeCallStatistics {
+ public:
+  RuntimeCallStatistics();
+  const char* counter_name() { return counter_name_; }
+  size_t call_count() { return call_count_; }
+  size_t total_time() { return total_time_; }
+  size_t median_time() { return median_time_; }
+  size_t p90_time() { return p90_time_; }
+  size_t p99_time() { return p99_time_; }
+  size_t max_time() { return max_time_; }
+
+ private:
+  const char* counter_name_;
+  size_t call_count_;
+  size_t total_time_;
+  size_t median_time_;
+  size_t p90_time_;
+  size_t p99_time_;
+  size_t max_time_;
+
+  friend class Isolate;
+};
+
+/**
+ * A deoptimization of optimized code, or the deoptimizations at one site,
+ * see Isolate::GetDeoptimizationEvent and
+ * Isolate::GetTopDeoptimizationSites. The event holds copies of the function
+ * and script names, truncated to kMaxNameLength bytes.
+ */
+class V8_EXPORT DeoptimizationEvent {
+ public:
+  static const size_t kMaxNameLength = 127;
+
+  DeoptimizationEvent();
+  /**
+   * The deoptimized function, which is the innermost inlined function if the
+   * deoptimization happened in inlined code.
+   */
+  const char* function_name() { return function_name_; }
+  const char* script_name() { return script_name_; }
+  /** The id of the script of the function, or -1 if it has none. */
+  int script_id() { return script_id_; }
+  /** The start position of the function in its script. */
+  int function_position() { return function_position_; }
+  /**
+   * The bytecode offset at which execution continues in the function, or -1
+   * if it does not continue in the interpreter.
+   */
+  int bytecode_offset() { return bytecode_offset_; }
+  const char* reason() { return reason_; }
+  /** One of "eager", "soft" or "lazy". */
+  const char* bailout_type() { return bailout_type_; }
+  /**
+   * The time of the last deoptimization in milliseconds since the isolate
+   * was created.
+   */
+  double timestamp() { return timestamp_; }
+  /** The number of deoptimizations at the site, 1 for single events. */
+  size_t count() { return count_; }
+
+ private:
+  char function_name_[kMaxNameLength + 1];
+  char script_name_[kMaxNameLength + 1];
+  int script_id_;
+  int function_position_;
+  int bytecode_offset_;
+  const char* reason_;
+  const char* bailout_type_;
+  double timestamp_;
+  size_t count_;
+
+  friend class Isolate;
+};
+
+/**
+ * The execution tier, code size and inline cache states of a function in a
+ * context, see Isolate::VisitFunctionStatistics.
+ */
+class V8_EXPORT FunctionStatistics {
+ public:
+  enum Tier { kNotCompiled, kInterpreted, kBaseline, kOptimized };
+  enum ICState {
+    kUninitialized,
+    kPremonomorphic,
+    kMonomorphic,
+    kRecomputeHandler,
+    kPolymorphic,
+    kMegamorphic,
+    kGeneric,
+    kICStateCount
+  };
+
+  FunctionStatistics();
+  /** The function name, which is only valid during the visit. */
+  const char* function_name() { return function_name_; }
+  int script_id() { return script_id_; }
+  /** The start position of the function in its script. */
+  int function_position() { return function_position_; }
+  Tier tier() { return tier_; }
+  /** The size of the bytecode or machine code of the tier. */
+  size_t code_size() { return code_size_; }
+  int opt_count() { return opt_count_; }
+  int deopt_count() { return deopt_count_; }
+  /** The number of inline caches of the function in the given state. */
+  int ic_count(ICState state) { return ic_counts_[state]; }
+
+ private:
+  const char* function_name_;
+  int script_id_;
+  int function_position_;
+  Tier tier_;
+  size_t code_size_;
+  int opt_count_;
+  int deopt_count_;
+  int ic_counts_[kICStateCount];
+
+  friend class Isolate;
+};
+
+/**
+ * Interface for iterating through the functions of scripts, see
+ * Isolate::VisitFunctionStatistics. The visitor must not call into V8.
+ */
+class V8_EXPORT FunctionStatisticsVisitor {  // NOLINT
+ public:
+  virtual ~FunctionStatisticsVisitor() {}
+  virtual void VisitFunction(FunctionStatistics* function) {}
+  /**
+   * Called after VisitFunction for each inline cache of the function.
+   * |slot| is the index of its feedback slot and |kind| names the kind of
+   * the inline cache, like "LOAD_IC".
+   */
+  virtual void VisitInlineCache(FunctionStatistics* function, int slot,
+                                const char* kind,
+                                FunctionStatistics::ICState state) {}
+};
+
 class RetainedObjectInfo;
 
 
@@ -6652,6 +6867,109 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Sets a callback that is invoked at the end of every garbage collection
+   * with the breakdown of its pause. The callback runs inside the garbage
+   * collector, it must be fast and must not call into V8. Passing nullptr
+   * removes the callback.
+   */
+  void SetGCPauseCallback(GCPauseCallback callback, void* data = nullptr);
+
+  /**
+   * Returns the number of scopes for which GC pause statistics are kept.
+   */
+  size_t NumberOfGCPauseScopes();
+
+  /**
+   * Get the pause time statistics of a scope of the garbage collector
+   * aggregated since the last ResetGCPauseStatistics.
+   *
+   * \param statistics The GCPauseStatistics object to fill in.
+   * \param index The index of the scope, which ranges from 0 to
+   *   NumberOfGCPauseScopes() - 1.
+   * \returns true on success.
+   */
+  bool GetGCPauseStatistics(GCPauseStatistics* statistics, size_t index);
+
+  /**
+   * Clears the pause time statistics of all scopes.
+   */
+  void ResetGCPauseStatistics();
+
+  /**
+   * Starts aggregating latency histograms of the runtime functions, builtins
+   * and API functions called in this isolate. To keep the overhead low,
+   * only one in |sampling_interval| outermost calls is timed, together with
+   * the calls nested in it. Passing 0 stops aggregating, without clearing
+   * the histograms.
+   */
+  void SetRuntimeCallStatsSamplingInterval(int sampling_interval);
+
+  /**
+   * Returns the number of runtime call counters.
+   */
+  size_t NumberOfRuntimeCallCounters();
+
+  /**
+   * Get the latency statistics of a runtime call counter aggregated since
+   * the last ResetRuntimeCallStatistics.
+   *
+   * \param statistics The RuntimeCallStatistics object to fill in.
+   * \param index The index of the counter, which ranges from 0 to
+   *   NumberOfRuntimeCallCounters() - 1.
+   * \returns true on success.
+   */
+  bool GetRuntimeCallStatistics(RuntimeCallStatistics* statistics,
+                                size_t index);
+
+  /**
+   * Clears the latency histograms of all runtime call counters.
+   */
+  void ResetRuntimeCallStatistics();
+
+  /**
+   * Returns the number of recent deoptimizations that are kept, see
+   * --deopt-log-size.
+   */
+  size_t NumberOfDeoptimizationEvents();
+
+  /**
+   * Get a recent deoptimization.
+   *
+   * \param event The DeoptimizationEvent object to fill in.
+   * \param index The index of the event, from 0 for the oldest to
+   *   NumberOfDeoptimizationEvents() - 1 for the most recent one.
+   * \returns true on success.
+   */
+  bool GetDeoptimizationEvent(DeoptimizationEvent* event, size_t index);
+
+  /**
+   * Get the sites with the most deoptimizations since the last
+   * ClearDeoptimizationEvents, most frequent first. A site is a bytecode
+   * offset in a function together with the reason and type of the
+   * deoptimization.
+   *
+   * \param sites Caller allocated buffer for up to |max_sites| sites.
+   * \returns The number of sites filled in.
+   */
+  size_t GetTopDeoptimizationSites(DeoptimizationEvent* sites,
+                                   size_t max_sites);
+
+  /**
+   * Clears the recent deoptimizations and the counts per site.
+   */
+  void ClearDeoptimizationEvents();
+
+  /**
+   * Visits the functions of the script with the given id, or of
+   * all scripts if |script_id| is UnboundScript::kNoScriptId, together with
+   * the inline caches they have in |context|. Functions are visited in no
+   * particular order. This does not allocate on the JavaScript heap and is
+   * cheap enough to be used on live isolates.
+   */
+  void VisitFunctionStatistics(Local<Context> context, int script_id,
+                               FunctionStatisticsVisitor* visitor);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7056,6 +7374,28 @@ class V8_EXPORT Isolate {
    */
   void RestoreOriginalHeapLimit();
 
+  /**
+   * Returns a compact profile of the functions that have been optimized in
+   * this isolate, keyed by the source of their script and their position in
+   * it. Passing the profile to SetOptimizationProfile() in a later process
+   * lets V8 optimize these functions as soon as they get hot, instead of
+   * waiting for them to be sampled repeatedly.
+   * The profile records only how often each function has been optimized and
+   * deoptimized. It holds no type feedback, such as maps or call targets, so
+   * the optimized code is still specialized on the feedback collected in the
+   * later process.
+   * The caller acquires ownership of the data array in the return value.
+   */
+  StartupData CreateOptimizationProfile();
+
+  /**
+   * Installs a profile created by CreateOptimizationProfile(), typically right
+   * after the isolate has been created. Returns false if the profile is
+   * malformed or has been created by a different version of V8. Entries for
+   * functions whose source has changed in the meantime are ignored.
+   */
+  bool SetOptimizationProfile(const StartupData* profile);
+
   /**
    * Allows the host application to provide the address of a function that is
    * notified each time code is added, moved or removed.
@@ -35,17 +35,20 @@
 #include "src/conversions-inl.h"
 #include "src/counters.h"
 #include "src/debug/debug.h"
+#include "src/deoptimization-log.h"
 #include "src/deoptimizer.h"
 #include "src/execution.h"
 #include "src/frames-inl.h"
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
 #include "src/json-stringifier.h"
 #include "src/messages.h"
+#include "src/optimization-profile.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/pending-compilation-error-handler.h"
@@ -66,6 +69,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/startup-data-util.h"
 #include "src/tracing/trace-event.h"
+#include "src/type-feedback-vector-inl.h"
 #include "src/unicode-inl.h"
 #include "src/v8.h"
 #include "src/v8threads.h"
@@ -779,7 +783,8 @@ ResourceConstraints::ResourceConstraints()
       max_executable_size_(0),
       stack_limit_(NULL),
       code_range_size_(0),
-      max_zone_pool_size_(0) {}
+      max_zone_pool_size_(0),
+      stub_cache_size_(0) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -843,6 +848,7 @@ void SetResourceConstraints(i::Isolate* isolate,
                                    max_executable_size, code_range_size);
   }
   isolate->allocator()->ConfigureSegmentPool(max_pool_size);
+  isolate->set_stub_cache_size(constraints.stub_cache_size());
 
   if (constraints.stack_limit() != NULL) {
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
@@ -6110,7 +6116,9 @@ HeapStatistics::HeapStatistics()
       heap_size_limit_(0),
       malloced_memory_(0),
       peak_malloced_memory_(0),
-      does_zap_garbage_(0) {}
+      does_zap_garbage_(0),
+      allocation_rate_(0),
+      promotion_rate_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
@@ -6128,6 +6136,48 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+GCPauseStatistics::GCPauseStatistics()
+    : scope_name_(nullptr),
+      pause_count_(0),
+      total_time_(0),
+      median_time_(0),
+      p90_time_(0),
+      p99_time_(0),
+      max_time_(0) {}
+
+RuntimeCallStatistics::RuntimeCallStatistics()
+    : counter_name_(nullptr),
+      call_count_(0),
+      total_time_(0),
+      median_time_(0),
+      p90_time_(0),
+      p99_time_(0),
+      max_time_(0) {}
+
+DeoptimizationEvent::DeoptimizationEvent()
+    : script_id_(-1),
+      function_position_(0),
+      bytecode_offset_(-1),
+      reason_(nullptr),
+      bailout_type_(nullptr),
+      timestamp_(0),
+      count_(0) {
+  STATIC_ASSERT(kMaxNameLength == i::DeoptimizationLog::kMaxNameLength);
+  function_name_[0] = '\0';
+  script_name_[0] = '\0';
+}
+
+FunctionStatistics::FunctionStatistics()
+    : function_name_(nullptr),
+      script_id_(UnboundScript::kNoScriptId),
+      function_position_(0),
+      tier_(kNotCompiled),
+      code_size_(0),
+      opt_count_(0),
+      deopt_count_(0) {
+  for (int i = 0; i < kICStateCount; i++) ic_counts_[i] = 0;
+}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8165,6 +8215,10 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->peak_malloced_memory_ =
       isolate->allocator()->GetMaxMemoryUsage();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->allocation_rate_ = static_cast<size_t>(
+      heap->tracer()->CurrentAllocationThroughputInBytesPerMillisecond());
+  heap_statistics->promotion_rate_ = static_cast<size_t>(
+      heap->tracer()->CurrentPromotionThroughputInBytesPerMillisecond());
 }
 
 
@@ -8239,6 +8293,227 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::SetGCPauseCallback(GCPauseCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->SetPauseCallback(callback, data);
+}
+
+size_t Isolate::NumberOfGCPauseScopes() {
+  return static_cast<size_t>(i::GCTracer::kNumberOfPauseHistograms);
+}
+
+bool Isolate::GetGCPauseStatistics(GCPauseStatistics* statistics,
+                                   size_t index) {
+  if (!statistics) return false;
+  if (index >= NumberOfGCPauseScopes()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  int scope = static_cast<int>(index);
+  *statistics = GCPauseStatistics();
+  statistics->scope_name_ = i::GCTracer::PauseHistogramName(scope);
+  i::RuntimeCallHistogram* histogram =
+      isolate->heap()->tracer()->pause_histogram(scope);
+  if (histogram == nullptr) return true;
+  statistics->pause_count_ = static_cast<size_t>(histogram->count());
+  statistics->total_time_ =
+      static_cast<size_t>(histogram->total().InMicroseconds());
+  statistics->median_time_ =
+      static_cast<size_t>(histogram->ValueAtPercentile(50));
+  statistics->p90_time_ = static_cast<size_t>(histogram->ValueAtPercentile(90));
+  statistics->p99_time_ = static_cast<size_t>(histogram->ValueAtPercentile(99));
+  statistics->max_time_ = static_cast<size_t>(histogram->max());
+  return true;
+}
+
+void Isolate::ResetGCPauseStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->ResetPauseHistograms();
+}
+
+void Isolate::SetRuntimeCallStatsSamplingInterval(int sampling_interval) {
+  Utils::ApiCheck(sampling_interval >= 0,
+                  "v8::Isolate::SetRuntimeCallStatsSamplingInterval",
+                  "Sampling interval must not be negative");
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->SetHistogramSamplingInterval(
+      sampling_interval);
+}
+
+size_t Isolate::NumberOfRuntimeCallCounters() {
+  return static_cast<size_t>(i::RuntimeCallStats::counters_count);
+}
+
+bool Isolate::GetRuntimeCallStatistics(RuntimeCallStatistics* statistics,
+                                       size_t index) {
+  if (!statistics) return false;
+  if (index >= NumberOfRuntimeCallCounters()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  i::RuntimeCallCounter* counter =
+      &(stats->*i::RuntimeCallStats::counters[index]);
+  *statistics = RuntimeCallStatistics();
+  statistics->counter_name_ = counter->name();
+  i::RuntimeCallHistogram* histogram = counter->histogram();
+  if (histogram == nullptr) return true;
+  statistics->call_count_ = static_cast<size_t>(histogram->count());
+  statistics->total_time_ =
+      static_cast<size_t>(histogram->total().InMicroseconds());
+  statistics->median_time_ =
+      static_cast<size_t>(histogram->ValueAtPercentile(50));
+  statistics->p90_time_ = static_cast<size_t>(histogram->ValueAtPercentile(90));
+  statistics->p99_time_ = static_cast<size_t>(histogram->ValueAtPercentile(99));
+  statistics->max_time_ = static_cast<size_t>(histogram->max());
+  return true;
+}
+
+void Isolate::ResetRuntimeCallStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->ResetHistograms();
+}
+
+size_t Isolate::NumberOfDeoptimizationEvents() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->deoptimization_log()->event_count();
+}
+
+bool Isolate::GetDeoptimizationEvent(DeoptimizationEvent* event,
+                                     size_t index) {
+  if (!event) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::DeoptimizationLog* log = isolate->deoptimization_log();
+  if (index >= log->event_count()) return false;
+  const i::DeoptimizationLog::Event& source = log->event(index);
+  memcpy(event->function_name_, source.function_name,
+         sizeof(event->function_name_));
+  memcpy(event->script_name_, source.script_name,
+         sizeof(event->script_name_));
+  event->script_id_ = source.script_id;
+  event->function_position_ = source.function_position;
+  event->bytecode_offset_ = source.bytecode_offset;
+  event->reason_ = i::DeoptimizeReasonToString(source.reason);
+  event->bailout_type_ = source.bailout_type;
+  event->timestamp_ = source.timestamp;
+  event->count_ = source.count;
+  return true;
+}
+
+size_t Isolate::GetTopDeoptimizationSites(DeoptimizationEvent* sites,
+                                          size_t max_sites) {
+  if (!sites) return 0;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  std::vector<i::DeoptimizationLog::Event> top_sites =
+      isolate->deoptimization_log()->GetTopSites(max_sites);
+  for (size_t index = 0; index < top_sites.size(); index++) {
+    const i::DeoptimizationLog::Event& source = top_sites[index];
+    memcpy(sites[index].function_name_, source.function_name,
+           sizeof(sites[index].function_name_));
+    memcpy(sites[index].script_name_, source.script_name,
+           sizeof(sites[index].script_name_));
+    sites[index].script_id_ = source.script_id;
+    sites[index].function_position_ = source.function_position;
+    sites[index].bytecode_offset_ = source.bytecode_offset;
+    sites[index].reason_ = i::DeoptimizeReasonToString(source.reason);
+    sites[index].bailout_type_ = source.bailout_type;
+    sites[index].timestamp_ = source.timestamp;
+    sites[index].count_ = source.count;
+  }
+  return top_sites.size();
+}
+
+void Isolate::ClearDeoptimizationEvents() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->deoptimization_log()->Clear();
+}
+
+#define CHECK_IC_STATE(Public, Internal)                                \
+  STATIC_ASSERT(static_cast<int>(FunctionStatistics::Public) == \
+                static_cast<int>(i::Internal));
+CHECK_IC_STATE(kUninitialized, UNINITIALIZED)
+CHECK_IC_STATE(kPremonomorphic, PREMONOMORPHIC)
+CHECK_IC_STATE(kMonomorphic, MONOMORPHIC)
+CHECK_IC_STATE(kRecomputeHandler, RECOMPUTE_HANDLER)
+CHECK_IC_STATE(kPolymorphic, POLYMORPHIC)
+CHECK_IC_STATE(kMegamorphic, MEGAMORPHIC)
+CHECK_IC_STATE(kGeneric, GENERIC)
+#undef CHECK_IC_STATE
+
+void Isolate::VisitFunctionStatistics(Local<Context> context, int script_id,
+                                      FunctionStatisticsVisitor* visitor) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScope scope(isolate);
+  i::Handle<i::Context> native_context(
+      Utils::OpenHandle(*context)->native_context(), isolate);
+  std::vector<i::Handle<i::Script>> scripts;
+  {
+    i::Script::Iterator iterator(isolate);
+    while (i::Script* script = iterator.Next()) {
+      if (script_id == UnboundScript::kNoScriptId
+              ? script->type() != i::Script::TYPE_NORMAL
+              : script->id() != script_id) {
+        continue;
+      }
+      scripts.push_back(i::handle(script, isolate));
+    }
+  }
+
+  i::DisallowHeapAllocation no_gc;
+  for (i::Handle<i::Script> script : scripts) {
+    i::SharedFunctionInfo::ScriptIterator iterator(script);
+    while (i::SharedFunctionInfo* shared = iterator.Next()) {
+      FunctionStatistics function;
+      std::unique_ptr<char[]> name = shared->DebugName()->ToCString(
+          i::DISALLOW_NULLS, i::ROBUST_STRING_TRAVERSAL);
+      function.function_name_ = name.get();
+      function.script_id_ = script->id();
+      function.function_position_ = shared->start_position();
+      function.opt_count_ = shared->opt_count();
+      function.deopt_count_ = shared->deopt_count();
+
+      // Optimized code and the feedback vector are shared by the closures of
+      // a function in a native context through the optimized code map.
+      i::CodeAndLiterals cached =
+          shared->SearchOptimizedCodeMap(*native_context, i::BailoutId::None());
+      if (cached.code != nullptr) {
+        function.tier_ = FunctionStatistics::kOptimized;
+        function.code_size_ = cached.code->Size();
+      } else if (!shared->is_compiled()) {
+        function.tier_ = FunctionStatistics::kNotCompiled;
+      } else if (shared->IsInterpreted()) {
+        function.tier_ = FunctionStatistics::kInterpreted;
+        function.code_size_ = shared->bytecode_array()->Size();
+      } else {
+        function.tier_ = FunctionStatistics::kBaseline;
+        function.code_size_ = shared->code()->Size();
+      }
+
+      i::TypeFeedbackVector* vector = nullptr;
+      if (cached.literals != nullptr &&
+          !cached.literals->feedback_vector()->is_empty()) {
+        vector = cached.literals->feedback_vector();
+        i::TypeFeedbackMetadataIterator slots(vector->metadata());
+        while (slots.HasNext()) {
+          i::FeedbackVectorSlot slot = slots.Next();
+          if (slots.kind() == i::FeedbackVectorSlotKind::GENERAL) continue;
+          function.ic_counts_[vector->GetICState(slot)]++;
+        }
+      }
+      visitor->VisitFunction(&function);
+      if (vector == nullptr) continue;
+
+      i::TypeFeedbackMetadataIterator slots(vector->metadata());
+      while (slots.HasNext()) {
+        i::FeedbackVectorSlot slot = slots.Next();
+        i::FeedbackVectorSlotKind kind = slots.kind();
+        if (kind == i::FeedbackVectorSlotKind::GENERAL) continue;
+        visitor->VisitInlineCache(
+            &function, slot.ToInt(), i::TypeFeedbackMetadata::Kind2String(kind),
+            static_cast<FunctionStatistics::ICState>(vector->GetICState(slot)));
+      }
+    }
+  }
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -8477,6 +8752,24 @@ void Isolate::RestoreOriginalHeapLimit() {
   isolate->heap()->RestoreOriginalHeapLimit();
 }
 
+StartupData Isolate::CreateOptimizationProfile() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8(isolate);
+  return i::OptimizationProfile::Create(isolate);
+}
+
+bool Isolate::SetOptimizationProfile(const StartupData* profile) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  Utils::ApiCheck(profile != nullptr, "v8::Isolate::SetOptimizationProfile",
+                  "Profile must not be null");
+  ENTER_V8(isolate);
+  i::OptimizationProfile* optimization_profile =
+      i::OptimizationProfile::Deserialize(profile->data, profile->raw_size);
+  if (optimization_profile == nullptr) return false;
+  isolate->runtime_profiler()->SetOptimizationProfile(optimization_profile);
+  return true;
+}
+
 void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
                                      JitCodeEventHandler event_handler) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9373,6 +9666,12 @@ const CpuProfileNode* CpuProfileNode::GetChild(int index) const {
   return reinterpret_cast<const CpuProfileNode*>(child);
 }
 
+const CpuProfileNode* CpuProfileNode::GetParent() const {
+  const i::ProfileNode* parent =
+      reinterpret_cast<const i::ProfileNode*>(this)->parent();
+  return reinterpret_cast<const CpuProfileNode*>(parent);
+}
+
 
 const std::vector<CpuProfileDeoptInfo>& CpuProfileNode::GetDeoptInfos() const {
   const i::ProfileNode* node = reinterpret_cast<const i::ProfileNode*>(this);
@@ -9431,6 +9730,64 @@ int CpuProfile::GetSamplesCount() const {
   return reinterpret_cast<const i::CpuProfile*>(this)->samples_count();
 }
 
+int CpuProfileDelta::GetNodesCount() const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return static_cast<int>(delta->nodes().size());
+}
+
+const CpuProfileNode* CpuProfileDelta::GetNode(int index) const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return reinterpret_cast<const CpuProfileNode*>(delta->nodes().at(index));
+}
+
+int CpuProfileDelta::GetHitNodesCount() const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return static_cast<int>(delta->ticks().size());
+}
+
+const CpuProfileNode* CpuProfileDelta::GetHitNode(int index) const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return reinterpret_cast<const CpuProfileNode*>(
+      delta->ticks().at(index).first);
+}
+
+unsigned CpuProfileDelta::GetHitCount(int index) const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return delta->ticks().at(index).second;
+}
+
+unsigned CpuProfileDelta::GetTruncatedSamplesCount() const {
+  return reinterpret_cast<const i::CpuProfileDelta*>(this)
+      ->truncated_ticks_count();
+}
+
+int64_t CpuProfileDelta::GetStartTime() const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return (delta->start_time() - base::TimeTicks()).InMicroseconds();
+}
+
+int64_t CpuProfileDelta::GetEndTime() const {
+  const i::CpuProfileDelta* delta =
+      reinterpret_cast<const i::CpuProfileDelta*>(this);
+  return (delta->end_time() - base::TimeTicks()).InMicroseconds();
+}
+
+int64_t CpuProfileDelta::GetProcessingTime() const {
+  return reinterpret_cast<const i::CpuProfileDelta*>(this)
+      ->processing_time()
+      .InMicroseconds();
+}
+
+void CpuProfileDelta::Delete() {
+  delete reinterpret_cast<i::CpuProfileDelta*>(this);
+}
+
 CpuProfiler* CpuProfiler::New(Isolate* isolate) {
   return reinterpret_cast<CpuProfiler*>(
       new i::CpuProfiler(reinterpret_cast<i::Isolate*>(isolate)));
@@ -9444,6 +9801,32 @@ void CpuProfiler::SetSamplingInterval(int us) {
       base::TimeDelta::FromMicroseconds(us));
 }
 
+bool CpuProfiler::SetSamplingEvent(SamplingEvent event, uint64_t period) {
+  i::CpuProfiler* profiler = reinterpret_cast<i::CpuProfiler*>(this);
+  sampler::Sampler::PerfEvent perf_event;
+  switch (event) {
+    case kSamplingInterval:
+      profiler->clear_sampling_event();
+      return true;
+    case kCpuTime:
+      perf_event = sampler::Sampler::kPerfTaskClock;
+      break;
+    case kCpuCycles:
+      perf_event = sampler::Sampler::kPerfCycles;
+      break;
+    case kCacheMisses:
+      perf_event = sampler::Sampler::kPerfCacheMisses;
+      break;
+    case kBranchMisses:
+      perf_event = sampler::Sampler::kPerfBranchMisses;
+      break;
+    default:
+      UNREACHABLE();
+      return false;
+  }
+  return profiler->set_sampling_event(perf_event, period);
+}
+
 void CpuProfiler::CollectSample() {
   reinterpret_cast<i::CpuProfiler*>(this)->CollectSample();
 }
@@ -9460,6 +9843,19 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+void CpuProfiler::StartContinuousProfiling(Local<String> title,
+                                           unsigned max_nodes) {
+  // The root node always exists.
+  reinterpret_cast<i::CpuProfiler*>(this)->StartContinuousProfiling(
+      *Utils::OpenHandle(*title), i::Max(max_nodes, 1u));
+}
+
+CpuProfileDelta* CpuProfiler::TakeProfileDelta(Local<String> title) {
+  return reinterpret_cast<CpuProfileDelta*>(
+      reinterpret_cast<i::CpuProfiler*>(this)->TakeProfileDelta(
+          *Utils::OpenHandle(*title)));
+}
+
 
 void CpuProfiler::SetIdle(bool is_idle) {
   i::CpuProfiler* profiler = reinterpret_cast<i::CpuProfiler*>(this);
@@ -9548,6 +9944,19 @@ size_t HeapGraphNode::GetShallowSize() const {
 }
 
 
+size_t HeapGraphNode::GetRetainedSize() const {
+  i::HeapEntry* entry = ToInternal(this);
+  return entry->snapshot()->GetRetainedSize(entry);
+}
+
+
+const HeapGraphNode* HeapGraphNode::GetDominatorNode() const {
+  i::HeapEntry* entry = ToInternal(this);
+  return reinterpret_cast<const HeapGraphNode*>(
+      entry->snapshot()->GetDominator(entry));
+}
+
+
 int HeapGraphNode::GetChildrenCount() const {
   return ToInternal(this)->children_count();
 }
@@ -9657,6 +10066,13 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
           ->TakeSnapshot(control, resolver));
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(OutputStream* stream,
+                                            ActivityControl* control,
+                                            ObjectNameResolver* resolver) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      stream, control, resolver);
+}
+
 
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
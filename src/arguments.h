@@ -97,7 +97,8 @@ double ClobberDoubleRegisters(double x1, double x2, double x3, double x4);
   Type Name(int args_length, Object** args_object, Isolate* isolate) {        \
     DCHECK(isolate->context() == nullptr || isolate->context()->IsContext()); \
     CLOBBER_DOUBLE_REGISTERS();                                               \
-    if (V8_UNLIKELY(FLAG_runtime_stats)) {                                    \
+    if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(                              \
+            isolate->counters()->runtime_call_stats()))) {                    \
       return Stats_##Name(args_length, args_object, isolate);                 \
     }                                                                         \
     Arguments args(args_length, args_object);                                 \
@@ -54,10 +54,26 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   // We used to probe for coherent cache support, but on older CPUs it
   // causes crashes (crbug.com/524337), and newer CPUs don't even have
   // the feature any more.
+
+  // The instruction scheduler uses a different latency model for the small
+  // in-order cores found in big.LITTLE configurations.
+  if (strcmp(FLAG_mcpu, "auto") == 0) {
+    base::CPU cpu;
+    if (cpu.implementer() == base::CPU::ARM &&
+        (cpu.part() == base::CPU::ARM_CORTEX_A35 ||
+         cpu.part() == base::CPU::ARM_CORTEX_A53 ||
+         cpu.part() == base::CPU::ARM_CORTEX_A55)) {
+      supported_ |= 1u << IN_ORDER_CORE;
+    }
+  } else if (strcmp(FLAG_mcpu, "cortex-a53") == 0) {
+    supported_ |= 1u << IN_ORDER_CORE;
+  }
 }
 
 void CpuFeatures::PrintTarget() { }
-void CpuFeatures::PrintFeatures() {}
+void CpuFeatures::PrintFeatures() {
+  printf("IN_ORDER_CORE=%d\n", CpuFeatures::IsSupported(IN_ORDER_CORE));
+}
 
 // -----------------------------------------------------------------------------
 // CPURegList utilities.
@@ -59,6 +59,9 @@ class V8_BASE_EXPORT CPU final {
   static const int ARM_CORTEX_A9 = 0xc09;
   static const int ARM_CORTEX_A12 = 0xc0c;
   static const int ARM_CORTEX_A15 = 0xc0f;
+  static const int ARM_CORTEX_A35 = 0xd04;
+  static const int ARM_CORTEX_A53 = 0xd03;
+  static const int ARM_CORTEX_A55 = 0xd05;
 
   // Denver-specific part code
   static const int NVIDIA_DENVER_V10 = 0x002;
@@ -3802,6 +3802,26 @@ bool Genesis::InstallNatives(GlobalContextType context_type) {
     concat->shared()->set_length(1);
   }
 
+  // Install Map.prototype.get, Map.prototype.has, Map.prototype.set,
+  // Set.prototype.add and Set.prototype.has.
+  {
+    Handle<JSFunction> map_function(native_context()->js_map_fun());
+    Handle<JSObject> map_prototype(JSObject::cast(map_function->prototype()));
+    native_context()->set_map_get(*SimpleInstallFunction(
+        map_prototype, "get", Builtins::kMapPrototypeGet, 1, true));
+    native_context()->set_map_has(*SimpleInstallFunction(
+        map_prototype, "has", Builtins::kMapPrototypeHas, 1, true));
+    native_context()->set_map_set(*SimpleInstallFunction(
+        map_prototype, "set", Builtins::kMapPrototypeSet, 2, true));
+
+    Handle<JSFunction> set_function(native_context()->js_set_fun());
+    Handle<JSObject> set_prototype(JSObject::cast(set_function->prototype()));
+    native_context()->set_set_add(*SimpleInstallFunction(
+        set_prototype, "add", Builtins::kSetPrototypeAdd, 1, true));
+    native_context()->set_set_has(*SimpleInstallFunction(
+        set_prototype, "has", Builtins::kSetPrototypeHas, 1, true));
+  }
+
   InstallBuiltinFunctionIds();
 
   // Create a map for accessor property descriptors (a variant of JSObject
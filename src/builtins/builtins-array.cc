@@ -2210,6 +2210,249 @@ void Builtins::Generate_ArrayIndexOf(compiler::CodeAssemblerState* state) {
                                          search_element, start_from));
 }
 
+class ArrayBuiltinCodeStubAssembler : public CodeStubAssembler {
+ public:
+  explicit ArrayBuiltinCodeStubAssembler(compiler::CodeAssemblerState* state)
+      : CodeStubAssembler(state) {}
+
+  typedef compiler::Node Node;
+
+  enum class IteratingKind { kForEach, kSome, kEvery };
+
+  // Generates the body of Array.prototype.forEach, some and every. Fast
+  // JSArrays are walked directly on their backing store. As soon as the
+  // callback makes the array unfit for that, for instance by changing its
+  // elements kind or installing elements on the prototype chain, iteration
+  // continues from the current index in the generic loop.
+  void GenerateIteratingArrayBuiltinBody(const char* method_name,
+                                         IteratingKind kind);
+
+ private:
+  // Calls the callback for {value} at {k} and dispatches on its result.
+  void CallCallback(IteratingKind kind, Node* context, Node* callbackfn,
+                    Node* this_arg, Node* value, Node* k, Node* o,
+                    Label* if_continue, Label* if_return_true,
+                    Label* if_return_false);
+};
+
+void ArrayBuiltinCodeStubAssembler::CallCallback(
+    IteratingKind kind, Node* context, Node* callbackfn, Node* this_arg,
+    Node* value, Node* k, Node* o, Label* if_continue, Label* if_return_true,
+    Label* if_return_false) {
+  Callable call = CodeFactory::Call(isolate());
+  Node* result = CallJS(call, context, callbackfn, this_arg, value, k, o);
+  switch (kind) {
+    case IteratingKind::kForEach:
+      Goto(if_continue);
+      break;
+    case IteratingKind::kSome:
+      BranchIfToBooleanIsTrue(result, if_return_true, if_continue);
+      break;
+    case IteratingKind::kEvery:
+      BranchIfToBooleanIsTrue(result, if_continue, if_return_false);
+      break;
+  }
+}
+
+void ArrayBuiltinCodeStubAssembler::GenerateIteratingArrayBuiltinBody(
+    const char* method_name, IteratingKind kind) {
+  Node* receiver = Parameter(0);
+  Node* callbackfn = Parameter(1);
+  Node* this_arg = Parameter(2);
+  Node* context = Parameter(3 + 2);
+
+  Variable var_o(this, MachineRepresentation::kTagged),
+      var_len(this, MachineRepresentation::kTagged),
+      var_k(this, MachineRepresentation::kTagged);
+  Label if_nullorundefined(this, Label::kDeferred), to_object(this),
+      has_o(this, &var_o), has_len(this, &var_len),
+      if_noncallable(this, Label::kDeferred), check_fast(this),
+      fast_loop(this, &var_k), slow_loop(this, &var_k), done(this),
+      return_true(this), return_false(this);
+
+  // 1. Let O be ? ToObject(this value).
+  GotoIf(WordEqual(receiver, NullConstant()), &if_nullorundefined);
+  GotoIf(WordEqual(receiver, UndefinedConstant()), &if_nullorundefined);
+  var_o.Bind(receiver);
+  GotoIf(TaggedIsSmi(receiver), &to_object);
+  Branch(IsJSReceiver(receiver), &has_o, &to_object);
+
+  Bind(&if_nullorundefined);
+  {
+    Node* result = CallRuntime(
+        Runtime::kThrowCalledOnNullOrUndefined, context,
+        HeapConstant(factory()->NewStringFromAsciiChecked(method_name,
+                                                          TENURED)));
+    Return(result);  // Never reached.
+  }
+
+  Bind(&to_object);
+  {
+    Callable callable = CodeFactory::ToObject(isolate());
+    var_o.Bind(CallStub(callable, context, receiver));
+    Goto(&has_o);
+  }
+
+  // 2. Let len be ? ToLength(? Get(O, "length")).
+  Bind(&has_o);
+  Node* o = var_o.value();
+  {
+    Label if_isarray(this), if_isnotarray(this);
+    Branch(HasInstanceType(o, JS_ARRAY_TYPE), &if_isarray, &if_isnotarray);
+
+    Bind(&if_isarray);
+    {
+      var_len.Bind(LoadJSArrayLength(o));
+      Goto(&has_len);
+    }
+
+    Bind(&if_isnotarray);
+    {
+      Callable get_property = CodeFactory::GetProperty(isolate());
+      Node* length = CallStub(get_property, context, o,
+                              HeapConstant(factory()->length_string()));
+      Callable to_length = CodeFactory::ToLength(isolate());
+      var_len.Bind(CallStub(to_length, context, length));
+      Goto(&has_len);
+    }
+  }
+
+  // 3. If IsCallable(callbackfn) is false, throw a TypeError exception.
+  Bind(&has_len);
+  Node* len = var_len.value();
+  GotoIf(TaggedIsSmi(callbackfn), &if_noncallable);
+  Branch(IsCallableMap(LoadMap(callbackfn)), &check_fast, &if_noncallable);
+
+  Bind(&if_noncallable);
+  {
+    Node* result =
+        CallRuntime(Runtime::kThrowCalledNonCallable, context, callbackfn);
+    Return(result);  // Never reached.
+  }
+
+  // 4. Let k be 0.
+  Bind(&check_fast);
+  var_k.Bind(SmiConstant(Smi::kZero));
+  GotoUnless(TaggedIsSmi(len), &slow_loop);
+  Goto(&fast_loop);
+
+  // Fast path over the backing store. The array is re-checked before every
+  // element since the callback may have changed it in arbitrary ways.
+  Bind(&fast_loop);
+  {
+    Label if_fast(this), if_inbounds(this), if_double(this),
+        if_notdouble(this), call_callback(this), next(this);
+    Variable var_value(this, MachineRepresentation::kTagged);
+    Node* k = var_k.value();
+    GotoUnless(SmiLessThan(k, len), &done);
+    BranchIfFastJSArray(o, context, FastJSArrayAccessMode::INBOUNDS_READ,
+                        &if_fast, &slow_loop);
+
+    // Elements beyond the current length may still be found on the prototype
+    // chain of packed arrays, leave those to the generic loop.
+    Bind(&if_fast);
+    Branch(SmiLessThan(k, LoadJSArrayLength(o)), &if_inbounds, &slow_loop);
+
+    Bind(&if_inbounds);
+    Node* elements = LoadElements(o);
+    Node* index = SmiUntag(k);
+    Node* elements_kind = LoadMapElementsKind(LoadMap(o));
+    Branch(Int32GreaterThan(elements_kind, Int32Constant(FAST_HOLEY_ELEMENTS)),
+           &if_double, &if_notdouble);
+
+    // Holes can be skipped, the prototype chain has no elements.
+    Bind(&if_notdouble);
+    {
+      Node* value = LoadFixedArrayElement(elements, index);
+      GotoIf(WordEqual(value, TheHoleConstant()), &next);
+      var_value.Bind(value);
+      Goto(&call_callback);
+    }
+
+    Bind(&if_double);
+    {
+      Node* value = LoadFixedDoubleArrayElement(
+          elements, index, MachineType::Float64(), 0, INTPTR_PARAMETERS, &next);
+      var_value.Bind(AllocateHeapNumberWithValue(value));
+      Goto(&call_callback);
+    }
+
+    Bind(&call_callback);
+    CallCallback(kind, context, callbackfn, this_arg, var_value.value(), k, o,
+                 &next, &return_true, &return_false);
+
+    Bind(&next);
+    var_k.Bind(SmiAdd(k, SmiConstant(Smi::FromInt(1))));
+    Goto(&fast_loop);
+  }
+
+  // 5. Repeat, while k < len
+  Bind(&slow_loop);
+  {
+    Label if_present(this), next(this);
+    Node* k = var_k.value();
+    GotoUnlessNumberLessThan(k, len, &done);
+
+    // a. Let Pk be ! ToString(k).
+    // b. Let kPresent be ? HasProperty(O, Pk).
+    Node* k_present = HasProperty(o, k, context);
+    Branch(WordEqual(k_present, TrueConstant()), &if_present, &next);
+
+    // c. If kPresent is true, then
+    Bind(&if_present);
+    {
+      // i. Let kValue be ? Get(O, Pk).
+      Callable get_property = CodeFactory::GetProperty(isolate());
+      Node* value = CallStub(get_property, context, o, k);
+      // ii. Perform ? Call(callbackfn, T, « kValue, k, O »).
+      CallCallback(kind, context, callbackfn, this_arg, value, k, o, &next,
+                   &return_true, &return_false);
+    }
+
+    // d. Increase k by 1.
+    Bind(&next);
+    var_k.Bind(NumberInc(k));
+    Goto(&slow_loop);
+  }
+
+  Bind(&done);
+  switch (kind) {
+    case IteratingKind::kForEach:
+      Return(UndefinedConstant());
+      break;
+    case IteratingKind::kSome:
+      Return(FalseConstant());
+      break;
+    case IteratingKind::kEvery:
+      Return(TrueConstant());
+      break;
+  }
+
+  Bind(&return_true);
+  Return(TrueConstant());
+
+  Bind(&return_false);
+  Return(FalseConstant());
+}
+
+// ES6 #sec-array.prototype.foreach
+TF_BUILTIN(ArrayForEach, ArrayBuiltinCodeStubAssembler) {
+  GenerateIteratingArrayBuiltinBody("Array.prototype.forEach",
+                                    IteratingKind::kForEach);
+}
+
+// ES6 #sec-array.prototype.some
+TF_BUILTIN(ArraySome, ArrayBuiltinCodeStubAssembler) {
+  GenerateIteratingArrayBuiltinBody("Array.prototype.some",
+                                    IteratingKind::kSome);
+}
+
+// ES6 #sec-array.prototype.every
+TF_BUILTIN(ArrayEvery, ArrayBuiltinCodeStubAssembler) {
+  GenerateIteratingArrayBuiltinBody("Array.prototype.every",
+                                    IteratingKind::kEvery);
+}
+
 namespace {
 
 template <IterationKind kIterationKind>
@@ -0,0 +1,398 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/builtins/builtins-utils.h"
+#include "src/builtins/builtins.h"
+#include "src/code-stub-assembler.h"
+
+namespace v8 {
+namespace internal {
+
+typedef compiler::Node Node;
+
+class CollectionsBuiltinsAssembler : public CodeStubAssembler {
+ public:
+  explicit CollectionsBuiltinsAssembler(compiler::CodeAssemblerState* state)
+      : CodeStubAssembler(state) {}
+
+ protected:
+  // Returns the hash of {key} as a Word32, computed like Object::GetHash().
+  // Jumps to {if_no_hash} if {key} is an object without identity hash, which
+  // therefore cannot be in any collection.
+  Node* GetExistingHash(Node* context, Node* key, Label* if_no_hash);
+
+  // Returns the hash of {key} as a Word32, giving receivers without identity
+  // hash a new one like Object::GetOrCreateHash().
+  Node* GetOrCreateHash(Node* context, Node* key);
+
+  // Returns {key} with -0 normalized to +0. Keys are never stored as -0, since
+  // iteration exposes them.
+  Node* NormalizeKey(Node* key);
+
+  // Looks up {key} with the given {hash} in the OrderedHashTable {table}, like
+  // OrderedHashTable::FindEntry(). If found, {var_key_index} holds the index
+  // of the key slot of the entry in {table}.
+  template <typename CollectionType>
+  void FindOrderedHashTableEntry(Node* context, Node* table, Node* key,
+                                 Node* hash, Variable* var_key_index,
+                                 Label* if_found, Label* if_not_found);
+
+  // Looks up {key} in the table of the JSMap or JSSet {collection}.
+  template <typename CollectionType>
+  void FindCollectionEntry(Node* context, Node* collection, Node* key,
+                           Variable* var_key_index, Label* if_found,
+                           Label* if_not_found);
+
+  // Appends an entry for {key} with the given {hash} to the table of the JSMap
+  // or JSSet {collection}, like the self-hosted code did. The runtime function
+  // {grow_function} makes room if the table is full. Returns the index of the
+  // key slot of the new entry.
+  template <typename CollectionType>
+  Node* AddCollectionEntry(Node* context, Node* collection, Node* key,
+                           Node* hash, Runtime::FunctionId grow_function);
+};
+
+Node* CollectionsBuiltinsAssembler::GetExistingHash(Node* context, Node* key,
+                                                    Label* if_no_hash) {
+  Variable var_hash(this, MachineRepresentation::kWord32);
+  Label done(this, &var_hash), if_smi(this), if_name(this),
+      if_receiver(this), if_runtime(this, Label::kDeferred);
+
+  GotoIf(TaggedIsSmi(key), &if_smi);
+  Node* map = LoadMap(key);
+  Node* instance_type = LoadMapInstanceType(map);
+  GotoIf(Int32LessThanOrEqual(instance_type, Int32Constant(LAST_NAME_TYPE)),
+         &if_name);
+  Branch(IsJSReceiverInstanceType(instance_type), &if_receiver, &if_runtime);
+
+  Bind(&if_smi);
+  {
+    var_hash.Bind(ComputeIntegerHash(SmiUntag(key), Int32Constant(0)));
+    Goto(&done);
+  }
+
+  Bind(&if_name);
+  {
+    var_hash.Bind(LoadNameHash(key, &if_runtime));
+    Goto(&done);
+  }
+
+  Bind(&if_receiver);
+  {
+    // The identity hash of ordinary objects lives in the hash code symbol,
+    // special receivers are left to the runtime.
+    Variable var_value(this, MachineRepresentation::kTagged);
+    Label if_found(this);
+    Node* hash_code_symbol = LoadRoot(Heap::khash_code_symbolRootIndex);
+    TryGetOwnProperty(context, key, key, map, instance_type, hash_code_symbol,
+                      &if_found, &var_value, if_no_hash, &if_runtime);
+
+    Bind(&if_found);
+    GotoUnless(TaggedIsSmi(var_value.value()), if_no_hash);
+    var_hash.Bind(SmiToWord32(var_value.value()));
+    Goto(&done);
+  }
+
+  Bind(&if_runtime);
+  {
+    Node* hash = CallRuntime(Runtime::kGenericHash, context, key);
+    var_hash.Bind(SmiToWord32(hash));
+    Goto(&done);
+  }
+
+  Bind(&done);
+  return var_hash.value();
+}
+
+Node* CollectionsBuiltinsAssembler::GetOrCreateHash(Node* context, Node* key) {
+  Variable var_hash(this, MachineRepresentation::kWord32);
+  Label done(this, &var_hash), if_no_hash(this, Label::kDeferred);
+  var_hash.Bind(GetExistingHash(context, key, &if_no_hash));
+  Goto(&done);
+
+  Bind(&if_no_hash);
+  {
+    Node* hash = CallRuntime(Runtime::kGenericHash, context, key);
+    var_hash.Bind(SmiToWord32(hash));
+    Goto(&done);
+  }
+
+  Bind(&done);
+  return var_hash.value();
+}
+
+Node* CollectionsBuiltinsAssembler::NormalizeKey(Node* key) {
+  Variable var_key(this, MachineRepresentation::kTagged);
+  var_key.Bind(key);
+  Label done(this, &var_key), if_heap_number(this);
+  GotoIf(TaggedIsSmi(key), &done);
+  Branch(IsHeapNumberMap(LoadMap(key)), &if_heap_number, &done);
+  Bind(&if_heap_number);
+  {
+    GotoUnless(Float64Equal(LoadHeapNumberValue(key), Float64Constant(0.0)),
+               &done);
+    var_key.Bind(SmiConstant(Smi::kZero));
+    Goto(&done);
+  }
+  Bind(&done);
+  return var_key.value();
+}
+
+template <typename CollectionType>
+void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
+    Node* context, Node* table, Node* key, Node* hash, Variable* var_key_index,
+    Label* if_found, Label* if_not_found) {
+  Node* number_of_buckets = SmiUntag(
+      LoadFixedArrayElement(table, CollectionType::kNumberOfBucketsIndex));
+  Node* hash_word = ChangeUint32ToWord(hash);
+  Node* bucket =
+      WordAnd(hash_word, IntPtrSub(number_of_buckets, IntPtrConstant(1)));
+  Node* first_entry_index = IntPtrAdd(
+      number_of_buckets, IntPtrConstant(CollectionType::kHashTableStartIndex));
+
+  Variable var_link(this, MachineType::PointerRepresentation());
+  var_link.Bind(SmiUntag(LoadFixedArrayElement(
+      table, bucket, CollectionType::kHashTableStartIndex * kPointerSize)));
+
+  Label loop(this, &var_link), next_entry(this);
+  Goto(&loop);
+  Bind(&loop);
+  {
+    Node* link = var_link.value();
+    GotoIf(WordEqual(link, IntPtrConstant(CollectionType::kNotFound)),
+           if_not_found);
+
+    Node* entry =
+        WordAnd(link, IntPtrConstant(CollectionType::kLinkEntryMask));
+    Node* key_index = IntPtrAdd(
+        first_entry_index,
+        IntPtrMul(entry, IntPtrConstant(CollectionType::kEntrySize)));
+    var_key_index->Bind(key_index);
+
+    // Only look at the key if the hash bits in the link match.
+    GotoUnless(WordEqual(WordAnd(WordXor(link, hash_word),
+                                 IntPtrConstant(CollectionType::kLinkHashMask)),
+                         IntPtrConstant(0)),
+               &next_entry);
+    Node* candidate = LoadFixedArrayElement(table, key_index);
+    GotoIf(WordEqual(candidate, key), if_found);
+    // Keys are never -0, so SameValue behaves like SameValueZero here.
+    Branch(SameValue(key, candidate, context), if_found, &next_entry);
+
+    Bind(&next_entry);
+    var_link.Bind(SmiUntag(LoadFixedArrayElement(
+        table, key_index, CollectionType::kChainOffset * kPointerSize)));
+    Goto(&loop);
+  }
+}
+
+template <typename CollectionType>
+void CollectionsBuiltinsAssembler::FindCollectionEntry(
+    Node* context, Node* collection, Node* key, Variable* var_key_index,
+    Label* if_found, Label* if_not_found) {
+  // Normalize -0 to +0 like Map.prototype.set and Set.prototype.add do.
+  Node* normalized_key = NormalizeKey(key);
+  Node* hash = GetExistingHash(context, normalized_key, if_not_found);
+  Node* table = LoadObjectField(collection, JSCollection::kTableOffset);
+  FindOrderedHashTableEntry<CollectionType>(context, table, normalized_key,
+                                            hash, var_key_index, if_found,
+                                            if_not_found);
+}
+
+template <typename CollectionType>
+Node* CollectionsBuiltinsAssembler::AddCollectionEntry(
+    Node* context, Node* collection, Node* key, Node* hash,
+    Runtime::FunctionId grow_function) {
+  Variable var_table(this, MachineRepresentation::kTagged);
+  var_table.Bind(LoadObjectField(collection, JSCollection::kTableOffset));
+  Label add_entry(this, &var_table), grow(this, Label::kDeferred);
+  {
+    Node* table = var_table.value();
+    Node* number_of_buckets = SmiUntag(
+        LoadFixedArrayElement(table, CollectionType::kNumberOfBucketsIndex));
+    Node* used_capacity = IntPtrAdd(
+        SmiUntag(LoadFixedArrayElement(table,
+                                       CollectionType::kNumberOfElementsIndex)),
+        SmiUntag(LoadFixedArrayElement(
+            table, CollectionType::kNumberOfDeletedElementsIndex)));
+    Node* capacity = IntPtrMul(number_of_buckets,
+                               IntPtrConstant(CollectionType::kLoadFactor));
+    Branch(IntPtrGreaterThanOrEqual(used_capacity, capacity), &grow,
+           &add_entry);
+  }
+
+  Bind(&grow);
+  {
+    CallRuntime(grow_function, context, collection);
+    var_table.Bind(LoadObjectField(collection, JSCollection::kTableOffset));
+    Goto(&add_entry);
+  }
+
+  Bind(&add_entry);
+  Node* table = var_table.value();
+  Node* number_of_buckets = SmiUntag(
+      LoadFixedArrayElement(table, CollectionType::kNumberOfBucketsIndex));
+  Node* number_of_elements = SmiUntag(
+      LoadFixedArrayElement(table, CollectionType::kNumberOfElementsIndex));
+  Node* entry = IntPtrAdd(
+      number_of_elements,
+      SmiUntag(LoadFixedArrayElement(
+          table, CollectionType::kNumberOfDeletedElementsIndex)));
+  Node* key_index = IntPtrAdd(
+      IntPtrAdd(number_of_buckets,
+                IntPtrConstant(CollectionType::kHashTableStartIndex)),
+      IntPtrMul(entry, IntPtrConstant(CollectionType::kEntrySize)));
+
+  // Put the new entry in front of the chain of its bucket.
+  Node* hash_word = ChangeUint32ToWord(hash);
+  Node* bucket =
+      WordAnd(hash_word, IntPtrSub(number_of_buckets, IntPtrConstant(1)));
+  int bucket_offset = CollectionType::kHashTableStartIndex * kPointerSize;
+  Node* chain_link = LoadFixedArrayElement(table, bucket, bucket_offset);
+  Node* link = WordOr(
+      WordAnd(hash_word, IntPtrConstant(CollectionType::kLinkHashMask)),
+      entry);
+  StoreFixedArrayElement(table, key_index, key);
+  StoreFixedArrayElement(table, key_index, chain_link, SKIP_WRITE_BARRIER,
+                         CollectionType::kChainOffset * kPointerSize);
+  StoreFixedArrayElement(table, bucket, SmiTag(link), SKIP_WRITE_BARRIER,
+                         bucket_offset);
+  StoreFixedArrayElement(table, CollectionType::kNumberOfElementsIndex,
+                         SmiTag(IntPtrAdd(number_of_elements,
+                                          IntPtrConstant(1))),
+                         SKIP_WRITE_BARRIER);
+  return key_index;
+}
+
+// -----------------------------------------------------------------------------
+// ES6 section 23.1 Map Objects
+
+// ES6 #sec-map.prototype.get
+TF_BUILTIN(MapPrototypeGet, CollectionsBuiltinsAssembler) {
+  Node* receiver = Parameter(0);
+  Node* key = Parameter(1);
+  Node* context = Parameter(4);
+
+  ThrowIfNotInstanceType(context, receiver, JS_MAP_TYPE, "Map.prototype.get");
+
+  Variable var_key_index(this, MachineType::PointerRepresentation());
+  Label if_found(this), if_not_found(this);
+  FindCollectionEntry<OrderedHashMap>(context, receiver, key, &var_key_index,
+                                      &if_found, &if_not_found);
+
+  Bind(&if_found);
+  Node* table = LoadObjectField(receiver, JSMap::kTableOffset);
+  Return(LoadFixedArrayElement(table, var_key_index.value(), kPointerSize));
+
+  Bind(&if_not_found);
+  Return(UndefinedConstant());
+}
+
+// ES6 #sec-map.prototype.has
+TF_BUILTIN(MapPrototypeHas, CollectionsBuiltinsAssembler) {
+  Node* receiver = Parameter(0);
+  Node* key = Parameter(1);
+  Node* context = Parameter(4);
+
+  ThrowIfNotInstanceType(context, receiver, JS_MAP_TYPE, "Map.prototype.has");
+
+  Variable var_key_index(this, MachineType::PointerRepresentation());
+  Label if_found(this), if_not_found(this);
+  FindCollectionEntry<OrderedHashMap>(context, receiver, key, &var_key_index,
+                                      &if_found, &if_not_found);
+
+  Bind(&if_found);
+  Return(TrueConstant());
+
+  Bind(&if_not_found);
+  Return(FalseConstant());
+}
+
+// ES6 #sec-map.prototype.set
+TF_BUILTIN(MapPrototypeSet, CollectionsBuiltinsAssembler) {
+  Node* receiver = Parameter(0);
+  Node* key = Parameter(1);
+  Node* value = Parameter(2);
+  Node* context = Parameter(5);
+
+  ThrowIfNotInstanceType(context, receiver, JS_MAP_TYPE, "Map.prototype.set");
+
+  Node* normalized_key = NormalizeKey(key);
+  Node* hash = GetOrCreateHash(context, normalized_key);
+
+  Variable var_key_index(this, MachineType::PointerRepresentation());
+  Label if_found(this), if_not_found(this), store_value(this, &var_key_index);
+  Node* table = LoadObjectField(receiver, JSMap::kTableOffset);
+  FindOrderedHashTableEntry<OrderedHashMap>(context, table, normalized_key,
+                                            hash, &var_key_index, &if_found,
+                                            &if_not_found);
+
+  Bind(&if_not_found);
+  var_key_index.Bind(AddCollectionEntry<OrderedHashMap>(
+      context, receiver, normalized_key, hash, Runtime::kMapGrow));
+  Goto(&store_value);
+
+  Bind(&if_found);
+  Goto(&store_value);
+
+  Bind(&store_value);
+  // The table may have been replaced while adding the entry.
+  table = LoadObjectField(receiver, JSMap::kTableOffset);
+  StoreFixedArrayElement(table, var_key_index.value(), value,
+                         UPDATE_WRITE_BARRIER, kPointerSize);
+  Return(receiver);
+}
+
+// -----------------------------------------------------------------------------
+// ES6 section 23.2 Set Objects
+
+// ES6 #sec-set.prototype.add
+TF_BUILTIN(SetPrototypeAdd, CollectionsBuiltinsAssembler) {
+  Node* receiver = Parameter(0);
+  Node* key = Parameter(1);
+  Node* context = Parameter(4);
+
+  ThrowIfNotInstanceType(context, receiver, JS_SET_TYPE, "Set.prototype.add");
+
+  Node* normalized_key = NormalizeKey(key);
+  Node* hash = GetOrCreateHash(context, normalized_key);
+
+  Variable var_key_index(this, MachineType::PointerRepresentation());
+  Label if_found(this), if_not_found(this);
+  Node* table = LoadObjectField(receiver, JSSet::kTableOffset);
+  FindOrderedHashTableEntry<OrderedHashSet>(context, table, normalized_key,
+                                            hash, &var_key_index, &if_found,
+                                            &if_not_found);
+
+  Bind(&if_not_found);
+  AddCollectionEntry<OrderedHashSet>(context, receiver, normalized_key, hash,
+                                     Runtime::kSetGrow);
+  Return(receiver);
+
+  Bind(&if_found);
+  Return(receiver);
+}
+
+// ES6 #sec-set.prototype.has
+TF_BUILTIN(SetPrototypeHas, CollectionsBuiltinsAssembler) {
+  Node* receiver = Parameter(0);
+  Node* key = Parameter(1);
+  Node* context = Parameter(4);
+
+  ThrowIfNotInstanceType(context, receiver, JS_SET_TYPE, "Set.prototype.has");
+
+  Variable var_key_index(this, MachineType::PointerRepresentation());
+  Label if_found(this), if_not_found(this);
+  FindCollectionEntry<OrderedHashSet>(context, receiver, key, &var_key_index,
+                                      &if_found, &if_not_found);
+
+  Bind(&if_found);
+  Return(TrueConstant());
+
+  Bind(&if_not_found);
+  Return(FalseConstant());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -250,6 +250,12 @@ namespace internal {
   /* ES7 #sec-array.prototype.includes */                                      \
   TFJ(ArrayIncludes, 2)                                                        \
   TFJ(ArrayIndexOf, 2)                                                         \
+  /* ES6 #sec-array.prototype.foreach */                                       \
+  TFJ(ArrayForEach, 2)                                                         \
+  /* ES6 #sec-array.prototype.some */                                          \
+  TFJ(ArraySome, 2)                                                            \
+  /* ES6 #sec-array.prototype.every */                                         \
+  TFJ(ArrayEvery, 2)                                                           \
   CPP(ArrayPop)                                                                \
   CPP(ArrayPush)                                                               \
   TFJ(FastArrayPush, -1)                                                       \
@@ -463,6 +469,14 @@ namespace internal {
   TFS(LoadGlobalICInsideTypeofTrampoline, LOAD_GLOBAL_IC,                      \
       LoadGlobalICState::kInsideTypeOfState, LoadGlobal)                       \
                                                                                \
+  /* Map */                                                                    \
+  /* ES6 #sec-map.prototype.get */                                             \
+  TFJ(MapPrototypeGet, 1)                                                      \
+  /* ES6 #sec-map.prototype.has */                                             \
+  TFJ(MapPrototypeHas, 1)                                                      \
+  /* ES6 #sec-map.prototype.set */                                             \
+  TFJ(MapPrototypeSet, 2)                                                      \
+                                                                               \
   /* Math */                                                                   \
   /* ES6 section 20.2.2.1 Math.abs ( x ) */                                    \
   TFJ(MathAbs, 1)                                                              \
@@ -686,6 +700,12 @@ namespace internal {
   TFJ(RegExpPrototypeUnicodeGetter, 0)                                         \
   CPP(RegExpRightContextGetter)                                                \
                                                                                \
+  /* Set */                                                                    \
+  /* ES6 #sec-set.prototype.add */                                             \
+  TFJ(SetPrototypeAdd, 1)                                                      \
+  /* ES6 #sec-set.prototype.has */                                             \
+  TFJ(SetPrototypeHas, 1)                                                      \
+                                                                               \
   /* SharedArrayBuffer */                                                      \
   CPP(SharedArrayBufferPrototypeGetByteLength)                                 \
   TFJ(AtomicsLoad, 2)                                                          \
@@ -50,6 +50,7 @@ class CompilationInfo final {
     kBailoutOnUninitialized = 1 << 14,
     kOptimizeFromBytecode = 1 << 15,
     kLoopPeelingEnabled = 1 << 16,
+    kNonSpeculative = 1 << 17,
   };
 
   CompilationInfo(ParseInfo* parse_info, Handle<JSFunction> closure);
@@ -177,6 +178,13 @@ class CompilationInfo final {
 
   bool is_loop_peeling_enabled() const { return GetFlag(kLoopPeelingEnabled); }
 
+  // Non-speculative code is generated from bytecode without relying on type
+  // feedback, so it never deoptimizes. It mostly consists of calls to the
+  // same IC stubs and builtins the interpreter uses.
+  void MarkAsNonSpeculative() { SetFlag(kNonSpeculative); }
+
+  bool is_non_speculative() const { return GetFlag(kNonSpeculative); }
+
   bool GeneratePreagedPrologue() const {
     // Generate a pre-aged prologue if we are optimizing for size, which
     // will make code flushing more aggressive. Only apply to Code::FUNCTION,
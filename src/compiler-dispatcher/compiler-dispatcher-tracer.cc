@@ -22,11 +22,20 @@ const double kEstimatedRuntimeWithoutData = 1.0;
 
 CompilerDispatcherTracer::Scope::Scope(CompilerDispatcherTracer* tracer,
                                        ScopeID scope_id, size_t num)
-    : tracer_(tracer), scope_id_(scope_id), num_(num) {
+    : tracer_(tracer),
+      scope_id_(scope_id),
+      num_(num),
+      runtime_call_stats_(tracer->runtime_call_stats_) {
   start_time_ = MonotonicallyIncreasingTimeInMs();
+  // Sampling only updates the isolate's stats from the main thread, jobs
+  // running on worker threads must leave them alone.
+  if (!FLAG_runtime_stats && runtime_call_stats_ != nullptr &&
+      !ThreadId::Current().Equals(tracer_->isolate_->thread_id())) {
+    runtime_call_stats_ = nullptr;
+  }
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Enter(tracer_->runtime_call_stats_, &timer_,
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(runtime_call_stats_))) {
+    RuntimeCallStats::Enter(runtime_call_stats_, &timer_,
                             &RuntimeCallStats::CompilerDispatcher);
   }
 }
@@ -54,8 +63,8 @@ CompilerDispatcherTracer::Scope::~Scope() {
       break;
   }
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Leave(tracer_->runtime_call_stats_, &timer_);
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(runtime_call_stats_))) {
+    RuntimeCallStats::Leave(runtime_call_stats_, &timer_);
   }
 }
 
@@ -80,7 +89,7 @@ const char* CompilerDispatcherTracer::Scope::Name(ScopeID scope_id) {
 }
 
 CompilerDispatcherTracer::CompilerDispatcherTracer(Isolate* isolate)
-    : runtime_call_stats_(nullptr) {
+    : isolate_(isolate), runtime_call_stats_(nullptr) {
   // isolate might be nullptr during unittests.
   if (isolate) {
     runtime_call_stats_ = isolate->counters()->runtime_call_stats();
@@ -52,6 +52,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcherTracer {
     ScopeID scope_id_;
     size_t num_;
     double start_time_;
+    RuntimeCallStats* runtime_call_stats_;
     RuntimeCallTimer timer_;
 
     DISALLOW_COPY_AND_ASSIGN(Scope);
@@ -87,6 +88,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcherTracer {
   base::RingBuffer<std::pair<size_t, double>> compile_events_;
   base::RingBuffer<double> finalize_compiling_events_;
 
+  Isolate* isolate_;
   RuntimeCallStats* runtime_call_stats_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilerDispatcherTracer);
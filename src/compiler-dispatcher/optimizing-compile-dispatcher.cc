@@ -15,22 +15,6 @@
 namespace v8 {
 namespace internal {
 
-namespace {
-
-void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
-  if (restore_function_code) {
-    Handle<JSFunction> function = job->info()->closure();
-    function->ReplaceCode(function->shared()->code());
-    // TODO(mvstanton): We can't call ensureliterals here due to allocation,
-    // but we probably shouldn't call ReplaceCode either, as this
-    // sometimes runs on the worker thread!
-    // JSFunction::EnsureLiterals(function);
-  }
-  delete job;
-}
-
-}  // namespace
-
 class OptimizingCompileDispatcher::CompileTask : public v8::Task {
  public:
   explicit CompileTask(Isolate* isolate) : isolate_(isolate) {
@@ -85,9 +69,51 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   }
 #endif
   DCHECK_EQ(0, input_queue_length_);
+  DCHECK_EQ(0, pending_osr_jobs_.length());
   DeleteArray(input_queue_);
 }
 
+void OptimizingCompileDispatcher::DisposeCompilationJob(
+    CompilationJob* job, bool restore_function_code) {
+  // OSR jobs never mark the function, so there is nothing to restore.
+  if (job->info()->is_osr()) {
+    RemovePendingOsrJob(job);
+  } else if (restore_function_code) {
+    Handle<JSFunction> function = job->info()->closure();
+    function->ReplaceCode(function->shared()->code());
+    // TODO(mvstanton): We can't call ensureliterals here due to allocation,
+    // but we probably shouldn't call ReplaceCode either, as this
+    // sometimes runs on the worker thread!
+    // JSFunction::EnsureLiterals(function);
+  }
+  delete job;
+}
+
+void OptimizingCompileDispatcher::RemovePendingOsrJob(CompilationJob* job) {
+  base::LockGuard<base::Mutex> access_pending_osr_jobs(
+      &pending_osr_jobs_mutex_);
+  for (int i = 0; i < pending_osr_jobs_.length(); ++i) {
+    if (pending_osr_jobs_[i] == job) {
+      pending_osr_jobs_.Remove(i);
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+bool OptimizingCompileDispatcher::HasPendingOsrJob(Handle<JSFunction> function,
+                                                   BailoutId osr_ast_id) {
+  base::LockGuard<base::Mutex> access_pending_osr_jobs(
+      &pending_osr_jobs_mutex_);
+  for (int i = 0; i < pending_osr_jobs_.length(); ++i) {
+    CompilationInfo* info = pending_osr_jobs_[i]->info();
+    if (*info->closure() == *function && info->osr_ast_id() == osr_ast_id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 CompilationJob* OptimizingCompileDispatcher::NextInput(bool check_if_flushing) {
   base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return NULL;
@@ -180,7 +206,12 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     }
     CompilationInfo* info = job->info();
     Handle<JSFunction> function(*info->closure());
-    if (function->IsOptimized()) {
+    if (info->is_osr()) {
+      // OSR code is still useful for frames that are stuck in a loop, even
+      // if the function itself has been optimized in the meantime.
+      RemovePendingOsrJob(job);
+      Compiler::FinalizeCompilationJob(job);
+    } else if (function->IsOptimized()) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
         function->ShortPrint();
@@ -195,6 +226,11 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 
 void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  if (job->info()->is_osr()) {
+    base::LockGuard<base::Mutex> access_pending_osr_jobs(
+        &pending_osr_jobs_mutex_);
+    pending_osr_jobs_.Add(job);
+  }
   {
     // Add job to the back of the input queue.
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
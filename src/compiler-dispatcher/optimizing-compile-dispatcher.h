@@ -12,12 +12,15 @@
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/flags.h"
+#include "src/globals.h"
+#include "src/handles.h"
 #include "src/list.h"
 
 namespace v8 {
 namespace internal {
 
 class CompilationJob;
+class JSFunction;
 class SharedFunctionInfo;
 
 class OptimizingCompileDispatcher {
@@ -43,6 +46,10 @@ class OptimizingCompileDispatcher {
   void Unblock();
   void InstallOptimizedFunctions();
 
+  // Returns true if an OSR job for {function} at {osr_ast_id} has been queued
+  // and not yet been finalized or disposed.
+  bool HasPendingOsrJob(Handle<JSFunction> function, BailoutId osr_ast_id);
+
   inline bool IsQueueAvailable() {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
     return input_queue_length_ < input_queue_capacity_;
@@ -56,6 +63,8 @@ class OptimizingCompileDispatcher {
   enum ModeFlag { COMPILE, FLUSH };
 
   void FlushOutputQueue(bool restore_function_code);
+  void DisposeCompilationJob(CompilationJob* job, bool restore_function_code);
+  void RemovePendingOsrJob(CompilationJob* job);
   void CompileNext(CompilationJob* job);
   CompilationJob* NextInput(bool check_if_flushing = false);
 
@@ -81,6 +90,11 @@ class OptimizingCompileDispatcher {
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // OSR jobs which are somewhere in the pipeline. Jobs can be disposed on the
+  // background thread while flushing, hence the mutex.
+  List<CompilationJob*> pending_osr_jobs_;
+  base::Mutex pending_osr_jobs_mutex_;
+
   volatile base::AtomicWord mode_;
 
   int blocked_jobs_;
@@ -497,6 +497,15 @@ MUST_USE_RESULT MaybeHandle<Code> GetUnoptimizedCode(CompilationInfo* info) {
   return info->code();
 }
 
+// OSR entries compiled from bytecode are identified by a bytecode offset, which
+// overlaps with the AST ids used for OSR entries from full-codegen. Map them to
+// a disjoint (negative) range of ids before using the optimized code map.
+BailoutId OptimizedCodeMapOsrId(BailoutId osr_ast_id, bool from_bytecode) {
+  if (osr_ast_id.IsNone() || !from_bytecode) return osr_ast_id;
+  DCHECK_LE(0, osr_ast_id.ToInt());
+  return BailoutId(BailoutId::None().ToInt() - 1 - osr_ast_id.ToInt());
+}
+
 MUST_USE_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeMap(
     Handle<JSFunction> function, BailoutId osr_ast_id) {
   Handle<SharedFunctionInfo> shared(function->shared());
@@ -523,17 +532,15 @@ void InsertCodeIntoOptimizedCodeMap(CompilationInfo* info) {
   // Frame specialization implies function context specialization.
   DCHECK(!info->is_frame_specializing());
 
-  // TODO(4764): When compiling for OSR from bytecode, BailoutId might derive
-  // from bytecode offset and overlap with actual BailoutId. No caching!
-  if (info->is_osr() && info->is_optimizing_from_bytecode()) return;
-
   // Cache optimized context-specific code.
   Handle<JSFunction> function = info->closure();
   Handle<SharedFunctionInfo> shared(function->shared());
   Handle<LiteralsArray> literals(function->literals());
   Handle<Context> native_context(function->context()->native_context());
+  BailoutId osr_id = OptimizedCodeMapOsrId(info->osr_ast_id(),
+                                           info->is_optimizing_from_bytecode());
   SharedFunctionInfo::AddToOptimizedCodeMap(shared, native_context, code,
-                                            literals, info->osr_ast_id());
+                                            literals, osr_id);
 }
 
 bool Renumber(ParseInfo* parse_info) {
@@ -649,21 +656,32 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   bool ignition_osr = osr_frame && osr_frame->is_interpreted();
   DCHECK_IMPLIES(ignition_osr, !osr_ast_id.IsNone());
   DCHECK_IMPLIES(ignition_osr, FLAG_ignition_osr);
+  // Only OSR from bytecode can be compiled concurrently, since full-codegen
+  // OSR code is specialized to the frame that triggered the request.
+  DCHECK_IMPLIES(mode == Compiler::CONCURRENT && !osr_ast_id.IsNone(),
+                 ignition_osr);
+
+  // Functions that deoptimized too often can still get non-speculative code
+  // from their bytecode, which cannot run into the same problem again.
+  bool non_speculative =
+      FLAG_turbo_baseline && shared->optimization_disabled() &&
+      shared->disable_optimization_reason() == kDeoptimizedTooManyTimes &&
+      shared->HasBytecodeArray() && osr_ast_id.IsNone() &&
+      mode == Compiler::NOT_CONCURRENT;
 
   // Shared function no longer needs to be tiered up
   shared->set_marked_for_tier_up(false);
 
   Handle<Code> cached_code;
-  // TODO(4764): When compiling for OSR from bytecode, BailoutId might derive
-  // from bytecode offset and overlap with actual BailoutId. No lookup!
-  if (!ignition_osr &&
-      GetCodeFromOptimizedCodeMap(function, osr_ast_id)
+  if (GetCodeFromOptimizedCodeMap(
+          function, OptimizedCodeMapOsrId(osr_ast_id, ignition_osr))
           .ToHandle(&cached_code)) {
     if (FLAG_trace_opt) {
       PrintF("[found optimized code for ");
       function->ShortPrint();
       if (!osr_ast_id.IsNone()) {
-        PrintF(" at OSR AST id %d", osr_ast_id.ToInt());
+        PrintF(" at OSR %s %d", ignition_osr ? "bytecode offset" : "AST id",
+               osr_ast_id.ToInt());
       }
       PrintF("]\n");
     }
@@ -681,14 +699,18 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   VMState<COMPILER> state(isolate);
   DCHECK(!isolate->has_pending_exception());
   PostponeInterruptsScope postpone(isolate);
-  bool use_turbofan = UseTurboFan(shared) || ignition_osr;
+  bool use_turbofan = UseTurboFan(shared) || ignition_osr || non_speculative;
   std::unique_ptr<CompilationJob> job(
       use_turbofan ? compiler::Pipeline::NewCompilationJob(function)
                    : new HCompilationJob(function));
   CompilationInfo* info = job->info();
   ParseInfo* parse_info = info->parse_info();
 
-  info->SetOptimizingForOsr(osr_ast_id, osr_frame);
+  // The frame is only used for specialization, which never happens when OSR
+  // compiling from bytecode. It must not outlive this call in any case, since
+  // a concurrent job runs after the frame has moved on.
+  info->SetOptimizingForOsr(
+      osr_ast_id, mode == Compiler::CONCURRENT ? nullptr : osr_frame);
 
   // Do not use Crankshaft/TurboFan if we need to be able to set break points.
   if (info->shared_info()->HasDebugInfo()) {
@@ -699,7 +721,7 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   // Limit the number of times we try to optimize functions.
   const int kMaxOptCount =
       FLAG_deopt_every_n_times == 0 ? FLAG_max_opt_count : 1000;
-  if (info->shared_info()->opt_count() > kMaxOptCount) {
+  if (!non_speculative && info->shared_info()->opt_count() > kMaxOptCount) {
     info->AbortOptimization(kDeoptimizedTooManyTimes);
     return MaybeHandle<Code>();
   }
@@ -714,6 +736,10 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     DCHECK(shared->HasBytecodeArray());
     info->MarkAsOptimizeFromBytecode();
   }
+  if (non_speculative) {
+    if (!info->is_optimizing_from_bytecode()) return MaybeHandle<Code>();
+    info->MarkAsNonSpeculative();
+  }
 
   // Verify that OSR compilations are delegated to the correct graph builder.
   // Depending on the underlying frame the semantics of the {BailoutId} differ
@@ -788,18 +814,37 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
     } else if (job->FinalizeJob() == CompilationJob::SUCCEEDED) {
       job->RecordOptimizedCompilationStats();
       RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG, info);
+      BailoutId osr_id = OptimizedCodeMapOsrId(
+          info->osr_ast_id(), info->is_optimizing_from_bytecode());
       if (shared
               ->SearchOptimizedCodeMap(info->context()->native_context(),
-                                       info->osr_ast_id())
+                                       osr_id)
               .code == nullptr) {
         InsertCodeIntoOptimizedCodeMap(info);
       }
       if (FLAG_trace_opt) {
         PrintF("[completed optimizing ");
         info->closure()->ShortPrint();
+        if (info->is_osr()) {
+          PrintF(" for OSR at bytecode offset %d", info->osr_ast_id().ToInt());
+        }
         PrintF("]\n");
       }
-      info->closure()->ReplaceCode(*info->code());
+      if (info->is_osr()) {
+        // OSR code cannot be entered through the function entry. Instead the
+        // back edges are re-armed, so that the next OSR request picks up the
+        // code from the optimized code map. The closure was never marked for
+        // an OSR job, so its code is left alone.
+        DCHECK(info->is_optimizing_from_bytecode());
+        DCHECK_NOT_NULL(
+            shared->SearchOptimizedCodeMap(info->context()->native_context(),
+                                           osr_id)
+                .code);
+        shared->bytecode_array()->set_osr_loop_nesting_level(
+            AbstractCode::kMaxLoopNestingMarker);
+      } else {
+        info->closure()->ReplaceCode(*info->code());
+      }
       return CompilationJob::SUCCEEDED;
     }
   }
@@ -810,7 +855,7 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
     info->closure()->ShortPrint();
     PrintF(" because: %s]\n", GetBailoutReason(info->bailout_reason()));
   }
-  info->closure()->ReplaceCode(shared->code());
+  if (!info->is_osr()) info->closure()->ReplaceCode(shared->code());
   return CompilationJob::FAILED;
 }
 
@@ -1688,10 +1733,11 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForNative(
 
 MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    BailoutId osr_ast_id,
-                                                   JavaScriptFrame* osr_frame) {
+                                                   JavaScriptFrame* osr_frame,
+                                                   ConcurrencyMode mode) {
   DCHECK(!osr_ast_id.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, NOT_CONCURRENT, osr_ast_id, osr_frame);
+  return GetOptimizedCode(function, mode, osr_ast_id, osr_frame);
 }
 
 CompilationJob* Compiler::PrepareUnoptimizedCompilationJob(
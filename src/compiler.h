@@ -136,9 +136,12 @@ class Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In {CONCURRENT} mode the compilation job might be queued instead, in which
+  // case the InOptimizationQueue builtin is returned. The finished code is
+  // picked up from the optimized code map by a later OSR request.
   MUST_USE_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BailoutId osr_ast_id,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame, ConcurrencyMode mode);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
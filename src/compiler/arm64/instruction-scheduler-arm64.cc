@@ -10,6 +10,12 @@ namespace compiler {
 
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+int InstructionScheduler::GetIssueWidth() {
+  // Cortex-A53 class cores are dual-issue, the out-of-order cores decode
+  // three instructions per cycle.
+  return CpuFeatures::IsSupported(IN_ORDER_CORE) ? 2 : 3;
+}
+
 
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
@@ -176,7 +182,122 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
+namespace {
+
+// Latencies for in-order cores such as the Cortex-A53, taken from the
+// published software optimization guides. These cores stall on every use of
+// a result which is not ready yet, so modeling loads and multiplies precisely
+// matters more than on out-of-order cores.
+int GetInOrderInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kArm64Add:
+    case kArm64Add32:
+    case kArm64And:
+    case kArm64And32:
+    case kArm64Bic:
+    case kArm64Bic32:
+    case kArm64Cmn:
+    case kArm64Cmn32:
+    case kArm64Cmp:
+    case kArm64Cmp32:
+    case kArm64Eon:
+    case kArm64Eon32:
+    case kArm64Eor:
+    case kArm64Eor32:
+    case kArm64Not:
+    case kArm64Not32:
+    case kArm64Or:
+    case kArm64Or32:
+    case kArm64Orn:
+    case kArm64Orn32:
+    case kArm64Sub:
+    case kArm64Sub32:
+    case kArm64Tst:
+    case kArm64Tst32:
+      // Shifted and extended register operands take an extra cycle.
+      return instr->addressing_mode() != kMode_None ? 2 : 1;
+
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadWord64:
+      return 3;
+
+    case kArm64LdrS:
+    case kArm64LdrD:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return 4;
+
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+    case kArm64Smull:
+    case kArm64Umull:
+      return 3;
+
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      return 4;
+
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+      return 12;
+
+    case kArm64Idiv:
+    case kArm64Udiv:
+      return 20;
+
+    case kArm64Imod32:
+    case kArm64Umod32:
+      return 15;
+
+    case kArm64Imod:
+    case kArm64Umod:
+      return 23;
+
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float32Mul:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float64Mul:
+    case kArm64Float32Cmp:
+    case kArm64Float64Cmp:
+      return 4;
+
+    case kArm64Float32Div:
+    case kArm64Float32Sqrt:
+      return 13;
+
+    case kArm64Float64Div:
+    case kArm64Float64Sqrt:
+      return 22;
+
+    default:
+      return 2;
+  }
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (CpuFeatures::IsSupported(IN_ORDER_CORE)) {
+    return GetInOrderInstructionLatency(instr);
+  }
+
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -1543,6 +1543,16 @@ void BytecodeGraphBuilder::BuildBinaryOpWithImmediate(const Operator* js_op) {
   environment()->BindAccumulator(node, Environment::kAttachFrameState);
 }
 
+void BytecodeGraphBuilder::BuildBinaryOpWithRegisters(const Operator* js_op) {
+  PrepareEagerCheckpoint();
+  Node* left =
+      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
+  Node* right =
+      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(1));
+  Node* node = NewNode(js_op, left, right);
+  environment()->BindAccumulator(node, Environment::kAttachFrameState);
+}
+
 void BytecodeGraphBuilder::VisitAddSmi() {
   BuildBinaryOpWithImmediate(
       javascript()->Add(GetBinaryOperationHint(kBinaryOperationSmiHintIndex)));
@@ -1573,6 +1583,11 @@ void BytecodeGraphBuilder::VisitShiftRightSmi() {
       GetBinaryOperationHint(kBinaryOperationSmiHintIndex)));
 }
 
+void BytecodeGraphBuilder::VisitAddRegisters() {
+  BuildBinaryOpWithRegisters(javascript()->Add(
+      GetBinaryOperationHint(kBinaryOperationRegistersHintIndex)));
+}
+
 void BytecodeGraphBuilder::VisitInc() {
   PrepareEagerCheckpoint();
   // Note: Use subtract -1 here instead of add 1 to ensure we always convert to
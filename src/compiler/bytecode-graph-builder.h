@@ -144,6 +144,7 @@ class BytecodeGraphBuilder {
   void BuildThrow();
   void BuildBinaryOp(const Operator* op);
   void BuildBinaryOpWithImmediate(const Operator* op);
+  void BuildBinaryOpWithRegisters(const Operator* op);
   void BuildCompareOp(const Operator* op);
   void BuildDelete(LanguageMode language_mode);
   void BuildCastOperator(const Operator* op);
@@ -312,6 +313,7 @@ class BytecodeGraphBuilder {
   static int const kBinaryOperationHintIndex = 1;
   static int const kCountOperationHintIndex = 0;
   static int const kBinaryOperationSmiHintIndex = 2;
+  static int const kBinaryOperationRegistersHintIndex = 2;
 
   DISALLOW_COPY_AND_ASSIGN(BytecodeGraphBuilder);
 };
@@ -212,12 +212,18 @@ void InstructionScheduler::ScheduleBlock() {
     }
   }
 
-  // Go through the ready list and schedule the instructions.
+  // Go through the ready list and schedule the instructions. Up to
+  // {issue_width} instructions whose operands are available are started in
+  // each nominal cycle.
+  const int issue_width = GetIssueWidth();
+  DCHECK_LE(1, issue_width);
   int cycle = 0;
   while (!ready_list.IsEmpty()) {
-    ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
+    for (int issued = 0; issued < issue_width && !ready_list.IsEmpty();
+         ++issued) {
+      ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
+      if (candidate == nullptr) break;
 
-    if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
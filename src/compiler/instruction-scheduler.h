@@ -39,6 +39,8 @@ class InstructionScheduler final : public ZoneObject {
   static bool SchedulerSupported();
 
  private:
+  friend class InstructionSchedulerTester;
+
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode: public ZoneObject {
@@ -192,8 +194,17 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
+  // Return an estimate of the number of cycles it takes for the result of the
+  // given instruction to be available. Targets may pick their numbers based
+  // on the microarchitecture detected by CpuFeatures.
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Return the number of instructions the target core can start in a single
+  // cycle. This is used as a simple throughput model: in-order cores benefit
+  // from a narrow issue window whereas wide out-of-order cores can overlap
+  // independent instructions more aggressively.
+  static int GetIssueWidth();
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   Isolate* isolate() { return sequence()->isolate(); }
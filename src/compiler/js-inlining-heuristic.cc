@@ -93,10 +93,15 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     }
     if (CanInlineFunction(function)) {
       can_inline = true;
+      candidate.total_size += function->shared()->ast_node_count();
     }
   }
   if (force_inline) return InlineCandidate(candidate);
-  if (!can_inline) return NoChange();
+  if (!can_inline) {
+    TRACE("Not considering call site #%d:%s, because no target is inlineable\n",
+          node->id(), node->op()->mnemonic());
+    return NoChange();
+  }
 
   // Stop inlining once the maximum allowed level is reached.
   int level = 0;
@@ -137,6 +142,19 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       break;
   }
 
+  // Don't spend the inlining budget on call sites that are rarely executed
+  // relative to the invocations of the function being optimized. Note that
+  // the frequency is NaN if there's no feedback at all, in which case we
+  // keep the candidate.
+  if (candidate.frequency < FLAG_min_inlining_frequency) {
+    TRACE(
+        "Not considering call site #%d:%s, because frequency %g is below "
+        "the threshold %g\n",
+        node->id(), node->op()->mnemonic(), candidate.frequency,
+        FLAG_min_inlining_frequency);
+    return NoChange();
+  }
+
   // In the general case we remember the candidate for later.
   candidates_.insert(candidate);
   return NoChange();
@@ -148,31 +166,64 @@ void JSInliningHeuristic::Finalize() {
 
   // We inline at most one candidate in every iteration of the fixpoint.
   // This is to ensure that we don't consume the full inlining budget
-  // on things that aren't called very often.
+  // on things that aren't called very often. Candidates are visited by
+  // decreasing benefit; a candidate that doesn't fit into the remaining
+  // budget is skipped rather than ending the search, so that smaller hot
+  // call sites still get inlined.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
-    if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) return;
+    if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) {
+      TRACE("Inlining budget of %d nodes exhausted\n",
+            FLAG_max_inlined_nodes_cumulative);
+      return;
+    }
     auto i = candidates_.begin();
     Candidate candidate = *i;
     candidates_.erase(i);
     // Make sure we don't try to inline dead candidate nodes.
-    if (!candidate.node->IsDead()) {
-      Reduction const reduction = InlineCandidate(candidate);
-      if (reduction.Changed()) return;
+    if (candidate.node->IsDead()) continue;
+    // Check the budget before expanding polymorphic call sites, so that
+    // we don't build a dispatch for targets that will never be inlined.
+    if (cumulative_count_ + candidate.total_size >
+        FLAG_max_inlined_nodes_cumulative) {
+      TRACE(
+          "Not inlining call site #%d:%s (size:%d), because it exceeds the "
+          "remaining budget of %d nodes\n",
+          candidate.node->id(), candidate.node->op()->mnemonic(),
+          candidate.total_size,
+          FLAG_max_inlined_nodes_cumulative - cumulative_count_);
+      continue;
     }
+    Reduction const reduction = InlineCandidate(candidate);
+    if (reduction.Changed()) return;
   }
 }
 
+Reduction JSInliningHeuristic::InlineTarget(Node* node,
+                                            Handle<JSFunction> function) {
+  int const size = function->shared()->ast_node_count();
+  if (mode_ == kGeneralInlining && !function->shared()->force_inline() &&
+      cumulative_count_ + size > FLAG_max_inlined_nodes_cumulative) {
+    TRACE("Not inlining %s (size:%d) into call site #%d:%s, budget exceeded\n",
+          function->shared()->DebugName()->ToCString().get(), size, node->id(),
+          node->op()->mnemonic());
+    return NoChange();
+  }
+  Reduction const reduction = inliner_.ReduceJSCall(node, function);
+  if (reduction.Changed()) {
+    cumulative_count_ += size;
+    TRACE("Inlined %s (size:%d) into call site #%d:%s, cumulative size %d\n",
+          function->shared()->DebugName()->ToCString().get(), size, node->id(),
+          node->op()->mnemonic(), cumulative_count_);
+  }
+  return reduction;
+}
+
 Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate) {
   int const num_calls = candidate.num_functions;
   Node* const node = candidate.node;
   if (num_calls == 1) {
-    Handle<JSFunction> function = candidate.functions[0];
-    Reduction const reduction = inliner_.ReduceJSCall(node, function);
-    if (reduction.Changed()) {
-      cumulative_count_ += function->shared()->ast_node_count();
-    }
-    return reduction;
+    return InlineTarget(node, candidate.functions[0]);
   }
 
   // Expand the JSCallFunction/JSCallConstruct node to a subgraph first if
@@ -251,14 +302,13 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate) {
                        num_calls + 1, calls);
   ReplaceWithValue(node, value, effect, control);
 
-  // Inline the individual, cloned call sites.
+  // Inline the individual, cloned call sites. The whole candidate fits into
+  // the budget here, so this only declines targets that the inliner itself
+  // rejects; those remain direct calls to the known target.
+  TRACE("Dispatching call site #%d:%s on %d targets\n", node->id(),
+        node->op()->mnemonic(), num_calls);
   for (int i = 0; i < num_calls; ++i) {
-    Handle<JSFunction> function = candidate.functions[i];
-    Node* node = calls[i];
-    Reduction const reduction = inliner_.ReduceJSCall(node, function);
-    if (reduction.Changed()) {
-      cumulative_count_ += function->shared()->ast_node_count();
-    }
+    InlineTarget(calls[i], candidate.functions[i]);
   }
 
   return Replace(value);
@@ -270,6 +320,9 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency < right.frequency) {
     return false;
+  } else if (left.total_size != right.total_size) {
+    // Among equally hot call sites prefer the cheaper ones.
+    return left.total_size < right.total_size;
   } else {
     return left.node->id() > right.node->id();
   }
@@ -278,8 +331,9 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
 void JSInliningHeuristic::PrintCandidates() {
   PrintF("Candidates for inlining (size=%zu):\n", candidates_.size());
   for (const Candidate& candidate : candidates_) {
-    PrintF("  #%d:%s, frequency:%g\n", candidate.node->id(),
-           candidate.node->op()->mnemonic(), candidate.frequency);
+    PrintF("  #%d:%s, frequency:%g, size:%d\n", candidate.node->id(),
+           candidate.node->op()->mnemonic(), candidate.frequency,
+           candidate.total_size);
     for (int i = 0; i < candidate.num_functions; ++i) {
       Handle<JSFunction> function = candidate.functions[i];
       PrintF("  - size:%d, name: %s\n", function->shared()->ast_node_count(),
@@ -40,6 +40,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
     int num_functions;
     Node* node = nullptr;    // The call site at which to inline.
     float frequency = 0.0f;  // Relative frequency of this call site.
+    int total_size = 0;      // Accumulated size of the inlineable targets.
   };
 
   // Comparator for candidates.
@@ -54,6 +55,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
   void PrintCandidates();
   Reduction InlineCandidate(Candidate const& candidate);
 
+  // Inlines {function} at the call {node} if the cumulative budget still has
+  // room for it.
+  Reduction InlineTarget(Node* node, Handle<JSFunction> function);
+
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
   JSGraph* jsgraph() const { return jsgraph_; }
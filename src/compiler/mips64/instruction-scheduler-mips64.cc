@@ -10,6 +10,8 @@ namespace compiler {
 
 bool InstructionScheduler::SchedulerSupported() { return false; }
 
+int InstructionScheduler::GetIssueWidth() { return 1; }
+
 
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
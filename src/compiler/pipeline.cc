@@ -568,11 +568,21 @@ class PipelineCompilationJob final : public CompilationJob {
 };
 
 PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
-  if (info()->shared_info()->asm_function()) {
+  if (info()->is_non_speculative()) {
+    // Without deoptimization support there is nothing to speculate on, and
+    // neither inlining nor specialization is worth the compile time.
+    DCHECK(info()->is_optimizing_from_bytecode());
+    DCHECK(!info()->is_osr());
+  } else if (info()->shared_info()->asm_function()) {
     if (info()->osr_frame() && !info()->is_optimizing_from_bytecode()) {
       info()->MarkAsFrameSpecializing();
     }
-    info()->MarkAsFunctionContextSpecializing();
+    // Concurrent OSR jobs (which have no frame) must produce code that can
+    // be cached in the optimized code map, since that's the only way for the
+    // next OSR request to pick it up.
+    if (!info()->is_osr() || info()->osr_frame()) {
+      info()->MarkAsFunctionContextSpecializing();
+    }
   } else {
     if (!FLAG_always_opt) {
       info()->MarkAsBailoutOnUninitialized();
@@ -581,8 +591,9 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
       info()->MarkAsLoopPeelingEnabled();
     }
   }
-  if (info()->is_optimizing_from_bytecode() ||
-      !info()->shared_info()->asm_function()) {
+  if (!info()->is_non_speculative() &&
+      (info()->is_optimizing_from_bytecode() ||
+       !info()->shared_info()->asm_function())) {
     info()->MarkAsDeoptimizationEnabled();
     if (FLAG_inline_accessors) {
       info()->MarkAsAccessorInliningEnabled();
@@ -590,7 +601,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
   }
   if (!info()->is_optimizing_from_bytecode()) {
     if (!Compiler::EnsureDeoptimizationSupport(info())) return FAILED;
-  } else if (FLAG_turbo_inlining) {
+  } else if (FLAG_turbo_inlining && !info()->is_non_speculative()) {
     info()->MarkAsInliningEnabled();
   }
 
@@ -865,6 +865,11 @@ void TopLevelLiveRange::CommitSpillMoves(InstructionSequence* sequence,
   DCHECK_IMPLIES(op.IsConstant(), GetSpillMoveInsertionLocations() == nullptr);
   Zone* zone = sequence->zone();
 
+  // TODO(v8): Values defined in a loop are spilled there on every iteration,
+  // even if they are only spilled after the loop. Sinking the spill to the
+  // loop exits needs what CommitSpillsInDeferredBlocks does for deferred
+  // code, and a later spill_start_index() for the reference maps.
+
   for (SpillMoveInsertionList* to_spill = GetSpillMoveInsertionLocations();
        to_spill != nullptr; to_spill = to_spill->next) {
     Instruction* instr = sequence->InstructionAt(to_spill->gap_index);
@@ -1702,6 +1707,9 @@ void ConstraintBuilder::MeetConstraintsAfter(int instr_index) {
   for (size_t i = 0; i < first->OutputCount(); i++) {
     InstructionOperand* output = first->OutputAt(i);
     if (output->IsConstant()) {
+      // Constants are rematerialized from their operand instead of spilled.
+      // TODO(v8): Rematerialize cheap computations, too. Gap moves can only
+      // copy operands, so this needs a way to emit instructions at reloads.
       int output_vreg = ConstantOperand::cast(output)->virtual_register();
       TopLevelLiveRange* range = data()->GetOrCreateLiveRangeFor(output_vreg);
       range->SetSpillStartIndex(instr_index + 1);
@@ -3517,20 +3525,40 @@ void SpillSlotLocator::LocateSpillSlots() {
 OperandAssigner::OperandAssigner(RegisterAllocationData* data) : data_(data) {}
 
 
-void OperandAssigner::AssignSpillSlots() {
-  ZoneVector<SpillRange*>& spill_ranges = data()->spill_ranges();
-  // Merge disjoint spill ranges
-  for (size_t i = 0; i < spill_ranges.size(); ++i) {
-    SpillRange* range = spill_ranges[i];
-    if (range == nullptr) continue;
-    if (range->IsEmpty()) continue;
-    for (size_t j = i + 1; j < spill_ranges.size(); ++j) {
-      SpillRange* other = spill_ranges[j];
-      if (other != nullptr && !other->IsEmpty()) {
-        range->TryMerge(other);
+// static
+void OperandAssigner::MergeSpillRanges(
+    const ZoneVector<SpillRange*>& spill_ranges, Zone* zone) {
+  // Visiting the ranges by increasing start position and merging each one
+  // into the first compatible slot found so far is the classic first-fit
+  // coloring of an interval graph; it keeps the number of slots close to the
+  // maximal number of simultaneously live spilled values, independent of the
+  // virtual register numbering.
+  ZoneVector<SpillRange*> sorted_ranges(zone);
+  for (SpillRange* range : spill_ranges) {
+    if (range == nullptr || range->IsEmpty()) continue;
+    sorted_ranges.push_back(range);
+  }
+  std::stable_sort(sorted_ranges.begin(), sorted_ranges.end(),
+                   [](const SpillRange* a, const SpillRange* b) {
+                     return a->Start() < b->Start();
+                   });
+  ZoneVector<SpillRange*> slots(zone);
+  for (SpillRange* range : sorted_ranges) {
+    bool merged = false;
+    for (SpillRange* slot : slots) {
+      if (slot->TryMerge(range)) {
+        merged = true;
+        break;
       }
     }
+    if (!merged) slots.push_back(range);
   }
+}
+
+void OperandAssigner::AssignSpillSlots() {
+  ZoneVector<SpillRange*>& spill_ranges = data()->spill_ranges();
+  // Merge disjoint spill ranges.
+  MergeSpillRanges(spill_ranges, data()->allocation_zone());
   // Allocate slots for the merged spill ranges.
   for (SpillRange* range : spill_ranges) {
     if (range == nullptr || range->IsEmpty()) continue;
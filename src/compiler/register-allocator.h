@@ -684,7 +684,8 @@ std::ostream& operator<<(std::ostream& os,
                          const PrintableLiveRange& printable_range);
 
 
-class SpillRange final : public ZoneObject {
+class V8_EXPORT_PRIVATE SpillRange final
+    : public NON_EXPORTED_BASE(ZoneObject) {
  public:
   static const int kUnassignedSlot = -1;
   SpillRange(TopLevelLiveRange* range, Zone* zone);
@@ -711,6 +712,12 @@ class SpillRange final : public ZoneObject {
   int byte_width() const { return byte_width_; }
   void Print() const;
 
+  // The first position at which this spill range needs its slot.
+  LifetimePosition Start() const {
+    return use_interval_ == nullptr ? LifetimePosition::MaxPosition()
+                                    : use_interval_->start();
+  }
+
  private:
   LifetimePosition End() const { return end_position_; }
   bool IsIntersectingWith(SpillRange* other) const;
@@ -1129,13 +1136,19 @@ class SpillSlotLocator final : public ZoneObject {
 };
 
 
-class OperandAssigner final : public ZoneObject {
+class V8_EXPORT_PRIVATE OperandAssigner final
+    : public NON_EXPORTED_BASE(ZoneObject) {
  public:
   explicit OperandAssigner(RegisterAllocationData* data);
 
   // Phase 5: assign spill splots.
   void AssignSpillSlots();
 
+  // Merges disjoint spill ranges so that they share a slot. The merged ranges
+  // are left empty.
+  static void MergeSpillRanges(const ZoneVector<SpillRange*>& spill_ranges,
+                               Zone* zone);
+
   // Phase 6: commit assignment.
   void CommitAssignment();
 
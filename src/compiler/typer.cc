@@ -1483,6 +1483,11 @@ Type* Typer::Visitor::JSCallFunctionTyper(Type* fun, Typer* t) {
         case kArrayUnshift:
           return t->cache_.kPositiveSafeInteger;
 
+        // Map and Set functions.
+        case kMapHas:
+        case kSetHas:
+          return Type::Boolean();
+
         // Object functions.
         case kObjectHasOwnProperty:
           return Type::Boolean();
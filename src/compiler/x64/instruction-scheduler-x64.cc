@@ -10,6 +10,12 @@ namespace compiler {
 
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
+int InstructionScheduler::GetIssueWidth() {
+  // The in-order Atom cores can issue two instructions per cycle, the big
+  // out-of-order cores sustain about four.
+  return CpuFeatures::IsSupported(ATOM) ? 2 : 4;
+}
+
 
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
@@ -149,9 +155,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Movsxwq:
     case kX64Movzxwq:
     case kX64Movsxlq:
-      DCHECK(instr->InputCount() >= 1);
-      return instr->InputAt(0)->IsRegister() ? kNoOpcodeFlags
-                                             : kIsLoadOperation;
+      return (instr->addressing_mode() == kMode_None) ? kNoOpcodeFlags
+                                                      : kIsLoadOperation;
 
     case kX64Movb:
     case kX64Movw:
@@ -159,9 +164,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
     case kX64Movl:
       if (instr->HasOutput()) {
-        DCHECK(instr->InputCount() >= 1);
-        return instr->InputAt(0)->IsRegister() ? kNoOpcodeFlags
-                                               : kIsLoadOperation;
+        return (instr->addressing_mode() == kMode_None) ? kNoOpcodeFlags
+                                                        : kIsLoadOperation;
       } else {
         return kHasSideEffect;
       }
@@ -197,7 +201,11 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // in an empirical way. The in-order Atom cores get their own numbers, as
+  // they cannot hide long latencies behind independent instructions.
+  const bool atom = CpuFeatures::IsSupported(ATOM);
+  // Latency of a load hitting the L1 data cache.
+  const int load_latency = atom ? 3 : 4;
   switch (instr->arch_opcode()) {
     case kCheckedLoadInt8:
     case kCheckedLoadUint8:
@@ -219,6 +227,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+      return atom ? 5 : 3;
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -231,8 +240,15 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
-      return 3;
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+      return atom ? 5 : 3;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -241,20 +257,24 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return atom ? 6 : 4;
+    case kAVXFloat64Mul:
+      return 5;
     case kX64Idiv:
-      return 49;
+      return atom ? 183 : 49;
     case kX64Idiv32:
-      return 35;
+      return atom ? 57 : 35;
     case kX64Udiv:
-      return 38;
+      return atom ? 168 : 38;
     case kX64Udiv32:
-      return 26;
+      return atom ? 50 : 26;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
+      return atom ? 34 : 13;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
@@ -264,7 +284,54 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 50;
     case kArchTruncateDoubleToI:
       return 6;
+    case kSSEInt32ToFloat64:
+    case kSSEInt32ToFloat32:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEUint32ToFloat32:
+      return atom ? 6 : 4;
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+      return 3;
+    case kX64Lea:
+    case kX64Lea32:
+      // The address generation unit computes lea on Atom, which delays the
+      // result for the ALU.
+      return atom ? 4 : 1;
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+      return (instr->addressing_mode() == kMode_None) ? 1 : load_latency;
+    case kX64Movl:
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return load_latency;
+      }
+      return 1;
+    case kX64Movq:
+      return instr->HasOutput() ? load_latency : 1;
+    case kX64Movsd:
+    case kX64Movss:
+      // Loads into XMM registers take an extra cycle for the bypass.
+      return instr->HasOutput() ? load_latency + 1 : 1;
+    case kX64StackCheck:
+      return load_latency;
     default:
+      // Arithmetic with a memory operand has to wait for the load first.
+      if (instr->addressing_mode() != kMode_None &&
+          (instr->HasOutput() || instr->flags_mode() != kFlags_none)) {
+        return load_latency + 1;
+      }
       return 1;
   }
 }
@@ -673,6 +673,7 @@ void Context::AddOptimizedCode(Code* code) {
   DCHECK(code->next_code_link()->IsUndefined(GetIsolate()));
   code->set_next_code_link(get(OPTIMIZED_CODE_LIST));
   set(OPTIMIZED_CODE_LIST, code, UPDATE_WEAK_WRITE_BARRIER);
+  GetHeap()->incremental_marking()->MarkBytecodeForDeoptimization(code);
 }
 
 
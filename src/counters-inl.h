@@ -36,11 +36,12 @@ void RuntimeCallTimer::Resume(base::TimeTicks now) {
   start_ticks_ = now;
 }
 
-RuntimeCallTimer* RuntimeCallTimer::Stop() {
+RuntimeCallTimer* RuntimeCallTimer::Stop(RuntimeCallHistogram* histogram) {
   if (!IsStarted()) return parent();
   base::TimeTicks now = Now();
   Pause(now);
   counter_->Increment();
+  if (histogram != nullptr) histogram->AddSample(elapsed_);
   CommitTimeToCounter();
 
   RuntimeCallTimer* parent_timer = parent();
@@ -63,8 +64,9 @@ base::TimeTicks RuntimeCallTimer::Now() {
 
 RuntimeCallTimerScope::RuntimeCallTimerScope(
     Isolate* isolate, RuntimeCallStats::CounterId counter_id) {
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    Initialize(isolate->counters()->runtime_call_stats(), counter_id);
+  RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
+    Initialize(stats, counter_id);
   }
 }
 
@@ -75,7 +77,7 @@ RuntimeCallTimerScope::RuntimeCallTimerScope(
 
 RuntimeCallTimerScope::RuntimeCallTimerScope(
     RuntimeCallStats* stats, RuntimeCallStats::CounterId counter_id) {
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
     Initialize(stats, counter_id);
   }
 }
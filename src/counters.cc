@@ -4,8 +4,10 @@
 
 #include "src/counters.h"
 
+#include <cmath>
 #include <iomanip>
 
+#include "src/base/bits.h"
 #include "src/base/platform/platform.h"
 #include "src/isolate.h"
 #include "src/log-inl.h"
@@ -278,6 +280,11 @@ void RuntimeCallCounter::Reset() {
   time_ = base::TimeDelta();
 }
 
+RuntimeCallHistogram* RuntimeCallCounter::GetOrCreateHistogram() {
+  if (!histogram_) histogram_.reset(new RuntimeCallHistogram());
+  return histogram_.get();
+}
+
 void RuntimeCallCounter::Dump(v8::tracing::TracedValue* value) {
   value->BeginArray(name_);
   value->AppendDouble(count_);
@@ -303,6 +310,56 @@ void RuntimeCallTimer::Snapshot() {
   Resume(now);
 }
 
+void RuntimeCallHistogram::AddSample(base::TimeDelta time) {
+  int64_t value = time.InMicroseconds();
+  value = Max(value, static_cast<int64_t>(0));
+  value = Min(value, (static_cast<int64_t>(1) << kMaxValueBits) - 1);
+  buckets_[BucketIndex(value)]++;
+  count_++;
+  max_ = Max(max_, value);
+  total_ += time;
+}
+
+void RuntimeCallHistogram::Reset() {
+  memset(buckets_, 0, sizeof(buckets_));
+  count_ = 0;
+  max_ = 0;
+  total_ = base::TimeDelta();
+}
+
+int64_t RuntimeCallHistogram::ValueAtPercentile(double percentile) const {
+  if (count_ == 0) return 0;
+  int64_t rank = static_cast<int64_t>(std::ceil(count_ * percentile / 100));
+  rank = Max(rank, static_cast<int64_t>(1));
+  int64_t seen = 0;
+  for (int i = 0; i < kBucketCount; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) return Min(BucketUpperBound(i), max_);
+  }
+  return max_;
+}
+
+// static
+int RuntimeCallHistogram::BucketIndex(int64_t value) {
+  DCHECK_LE(0, value);
+  DCHECK_GT(static_cast<int64_t>(1) << kMaxValueBits, value);
+  if (value < kSubBucketCount) return static_cast<int>(value);
+  int magnitude = 63 - base::bits::CountLeadingZeros64(value);
+  int shift = magnitude - kSubBucketBits;
+  return (shift + 1) * kSubBucketCount + static_cast<int>(value >> shift) -
+         kSubBucketCount;
+}
+
+// static
+int64_t RuntimeCallHistogram::BucketUpperBound(int index) {
+  DCHECK_LE(0, index);
+  DCHECK_GT(kBucketCount, index);
+  if (index < kSubBucketCount) return index;
+  int shift = index / kSubBucketCount - 1;
+  int64_t sub_bucket = index % kSubBucketCount + kSubBucketCount;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
 // static
 const RuntimeCallStats::CounterId RuntimeCallStats::counters[] = {
 #define CALL_RUNTIME_COUNTER(name) &RuntimeCallStats::name,
@@ -330,6 +387,21 @@ const int RuntimeCallStats::counters_count =
 // static
 void RuntimeCallStats::Enter(RuntimeCallStats* stats, RuntimeCallTimer* timer,
                              CounterId counter_id) {
+  if (V8_UNLIKELY(stats->skipped_depth_ > 0)) {
+    stats->skipped_depth_++;
+    return;
+  }
+  // Only sample outermost calls when the histograms are the sole reason to
+  // collect statistics, everything is timed anyway otherwise.
+  if (V8_UNLIKELY(stats->sampling_interval_ > 1) &&
+      stats->current_timer_.Value() == nullptr && FLAG_runtime_stats == 0) {
+    if (stats->sampling_countdown_ > 0) {
+      stats->sampling_countdown_--;
+      stats->skipped_depth_ = 1;
+      return;
+    }
+    stats->sampling_countdown_ = stats->sampling_interval_ - 1;
+  }
   RuntimeCallCounter* counter = &(stats->*counter_id);
   DCHECK(counter->name() != nullptr);
   timer->Start(counter, stats->current_timer_.Value());
@@ -338,8 +410,16 @@ void RuntimeCallStats::Enter(RuntimeCallStats* stats, RuntimeCallTimer* timer,
 
 // static
 void RuntimeCallStats::Leave(RuntimeCallStats* stats, RuntimeCallTimer* timer) {
+  if (V8_UNLIKELY(stats->skipped_depth_ > 0)) {
+    stats->skipped_depth_--;
+    return;
+  }
+  RuntimeCallHistogram* histogram = nullptr;
+  if (V8_UNLIKELY(stats->sampling_interval_ > 0)) {
+    histogram = timer->counter()->GetOrCreateHistogram();
+  }
   if (stats->current_timer_.Value() == timer) {
-    stats->current_timer_.SetValue(timer->Stop());
+    stats->current_timer_.SetValue(timer->Stop(histogram));
   } else {
     // Must be a Threading cctest. Walk the chain of Timers to find the
     // buried one that's leaving. We don't care about keeping nested timings
@@ -402,6 +482,20 @@ void RuntimeCallStats::Reset() {
   in_use_ = true;
 }
 
+void RuntimeCallStats::SetHistogramSamplingInterval(int sampling_interval) {
+  DCHECK_LE(0, sampling_interval);
+  sampling_interval_ = sampling_interval;
+  sampling_countdown_ = 0;
+}
+
+void RuntimeCallStats::ResetHistograms() {
+  for (const RuntimeCallStats::CounterId counter_id :
+       RuntimeCallStats::counters) {
+    RuntimeCallHistogram* histogram = (this->*counter_id).histogram();
+    if (histogram != nullptr) histogram->Reset();
+  }
+}
+
 void RuntimeCallStats::Dump(v8::tracing::TracedValue* value) {
   for (const RuntimeCallStats::CounterId counter_id :
        RuntimeCallStats::counters) {
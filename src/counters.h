@@ -5,6 +5,8 @@
 #ifndef V8_COUNTERS_H_
 #define V8_COUNTERS_H_
 
+#include <memory>
+
 #include "include/v8.h"
 #include "src/allocation.h"
 #include "src/base/atomic-utils.h"
@@ -484,6 +486,46 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
          value * ((current_ms - last_ms_) / interval_ms);
 }
 
+// A latency histogram of the own times of the calls to a RuntimeCallCounter.
+// Like an HDR histogram, the buckets are log-linear: every power of two is
+// split into kSubBucketCount buckets, so values are recorded with a relative
+// precision of 1 / kSubBucketCount from microseconds up to hours.
+class RuntimeCallHistogram final {
+ public:
+  static const int kSubBucketBits = 3;
+  static const int kSubBucketCount = 1 << kSubBucketBits;
+  // Times are recorded in microseconds, longer times are clamped to
+  // 2^kMaxValueBits - 1.
+  static const int kMaxValueBits = 32;
+  static const int kBucketCount =
+      (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+
+  RuntimeCallHistogram() { Reset(); }
+
+  void AddSample(base::TimeDelta time);
+  void Reset();
+
+  int64_t count() const { return count_; }
+  base::TimeDelta total() const { return total_; }
+  // The longest recorded time in microseconds.
+  int64_t max() const { return max_; }
+  // Returns the time in microseconds that the given percentage of the
+  // recorded calls did not exceed, rounded up to the end of its bucket.
+  int64_t ValueAtPercentile(double percentile) const;
+
+  static int BucketIndex(int64_t value);
+  // The largest value that is recorded in the bucket at {index}.
+  static int64_t BucketUpperBound(int index);
+
+ private:
+  uint32_t buckets_[kBucketCount];
+  int64_t count_;
+  int64_t max_;
+  base::TimeDelta total_;
+
+  DISALLOW_COPY_AND_ASSIGN(RuntimeCallHistogram);
+};
+
 class RuntimeCallCounter final {
  public:
   explicit RuntimeCallCounter(const char* name) : name_(name) {}
@@ -497,10 +539,16 @@ class RuntimeCallCounter final {
   void Increment() { count_++; }
   void Add(base::TimeDelta delta) { time_ += delta; }
 
+  // The histogram is allocated on first use and is not cleared by Reset(),
+  // which tracing calls for every top level trace event.
+  RuntimeCallHistogram* histogram() const { return histogram_.get(); }
+  RuntimeCallHistogram* GetOrCreateHistogram();
+
  private:
   const char* name_;
   int64_t count_ = 0;
   base::TimeDelta time_;
+  std::unique_ptr<RuntimeCallHistogram> histogram_;
 };
 
 // RuntimeCallTimer is used to keep track of the stack of currently active
@@ -517,7 +565,8 @@ class RuntimeCallTimer final {
 
   inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent);
   void Snapshot();
-  inline RuntimeCallTimer* Stop();
+  // Also records the own time of the call in {histogram} if it is given.
+  inline RuntimeCallTimer* Stop(RuntimeCallHistogram* histogram = nullptr);
 
  private:
   inline void Pause(base::TimeTicks now);
@@ -782,6 +831,7 @@ class RuntimeCallTimer final {
   V(LoadIC_LoadNonexistentDH)                    \
   V(LoadIC_LoadNonexistent)                      \
   V(LoadIC_LoadNormal)                           \
+  V(LoadIC_LoadNormalDH)                         \
   V(LoadIC_LoadScriptContextFieldStub)           \
   V(LoadIC_LoadViaGetter)                        \
   V(LoadIC_NonReceiver)                          \
@@ -863,11 +913,30 @@ class RuntimeCallStats final : public ZoneObject {
   V8_EXPORT_PRIVATE void Print(std::ostream& os);
   V8_NOINLINE void Dump(v8::tracing::TracedValue* value);
 
+  // Starts recording the own time of the calls in per-counter histograms,
+  // or stops recording if {sampling_interval} is 0. When no other runtime
+  // call statistics are collected, only one in {sampling_interval} outermost
+  // calls is timed, together with all calls nested in it, which keeps the
+  // overhead low enough to leave the histograms enabled in production.
+  // Histograms do not set FLAG_runtime_stats, so other isolates and the code
+  // generated for this one are not affected. API calls that optimized code
+  // makes directly are not timed.
+  V8_EXPORT_PRIVATE void SetHistogramSamplingInterval(int sampling_interval);
+  int histogram_sampling_interval() const { return sampling_interval_; }
+  V8_EXPORT_PRIVATE void ResetHistograms();
+
   RuntimeCallStats() {
     Reset();
     in_use_ = false;
   }
 
+  // Whether calls are timed, either for all isolates because of
+  // FLAG_runtime_stats or for the histograms of {stats}.
+  static bool IsEnabled(RuntimeCallStats* stats) {
+    return FLAG_runtime_stats ||
+           (stats != nullptr && stats->sampling_interval_ > 0);
+  }
+
   RuntimeCallTimer* current_timer() { return current_timer_.Value(); }
   bool InUse() { return in_use_; }
 
@@ -876,11 +945,17 @@ class RuntimeCallStats final : public ZoneObject {
   base::AtomicValue<RuntimeCallTimer*> current_timer_;
   // Used to track nested tracing scopes.
   bool in_use_;
+  // Histograms are recorded when the sampling interval is positive.
+  int sampling_interval_ = 0;
+  // Number of outermost calls left to skip until the next sampled one.
+  int sampling_countdown_ = 0;
+  // Nesting depth of the calls within a skipped outermost call.
+  int skipped_depth_ = 0;
 };
 
 #define CHANGE_CURRENT_RUNTIME_COUNTER(runtime_call_stats, counter_name) \
   do {                                                                   \
-    if (V8_UNLIKELY(FLAG_runtime_stats)) {                               \
+    if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(runtime_call_stats))) {  \
       RuntimeCallStats::CorrectCurrentCounterId(                         \
           runtime_call_stats, &RuntimeCallStats::counter_name);          \
     }                                                                    \
@@ -1050,6 +1125,8 @@ class RuntimeCallTimerScope {
   SC(total_compile_size, V8.TotalCompileSize)                         \
   /* Amount of source code compiled with the full codegen. */         \
   SC(total_full_codegen_source_size, V8.TotalFullCodegenSourceSize)   \
+  /* Amount of bytecode reclaimed by flushing cold functions. */      \
+  SC(total_flushed_bytecode_size, V8.TotalFlushedBytecodeSize)        \
   /* Number of contexts created from scratch. */                      \
   SC(contexts_created_from_scratch, V8.ContextsCreatedFromScratch)    \
   /* Number of contexts created by partial snapshot. */               \
@@ -1077,6 +1154,7 @@ class RuntimeCallTimerScope {
   SC(ic_keyed_load_generic_symbol, V8.ICKeyedLoadGenericSymbol)                \
   SC(ic_keyed_load_generic_slow, V8.ICKeyedLoadGenericSlow)                    \
   SC(ic_named_load_global_stub, V8.ICNamedLoadGlobalStub)                      \
+  SC(ic_load_normal_probe, V8.ICLoadNormalProbe)                               \
   SC(ic_store_normal_miss, V8.ICStoreNormalMiss)                               \
   SC(ic_store_normal_hit, V8.ICStoreNormalHit)                                 \
   SC(ic_binary_op_miss, V8.ICBinaryOpMiss)                                     \
@@ -0,0 +1,125 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimization-log.h"
+
+#include <algorithm>
+
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+bool DeoptimizationLog::SiteKey::operator<(const SiteKey& other) const {
+  if (script_id != other.script_id) return script_id < other.script_id;
+  if (function_position != other.function_position) {
+    return function_position < other.function_position;
+  }
+  if (bytecode_offset != other.bytecode_offset) {
+    return bytecode_offset < other.bytecode_offset;
+  }
+  if (reason != other.reason) return reason < other.reason;
+  // Bailout types are static strings and are compared by identity.
+  if (bailout_type != other.bailout_type) {
+    return bailout_type < other.bailout_type;
+  }
+  return strcmp(function_name, other.function_name) < 0;
+}
+
+DeoptimizationLog::DeoptimizationLog(size_t capacity)
+    : capacity_(capacity), next_event_(0) {}
+
+// static
+void DeoptimizationLog::CopyName(char* destination, const char* source) {
+  size_t length = strlen(source);
+  if (length > kMaxNameLength) {
+    length = kMaxNameLength;
+    // Do not cut a UTF-8 sequence in half.
+    while (length > 0 && (source[length] & 0xc0) == 0x80) length--;
+  }
+  memcpy(destination, source, length);
+  destination[length] = '\0';
+}
+
+void DeoptimizationLog::Record(SharedFunctionInfo* shared, int bytecode_offset,
+                               DeoptimizeReason reason,
+                               const char* bailout_type, double timestamp) {
+  DisallowHeapAllocation no_gc;
+  if (capacity_ == 0) return;
+
+  Event event;
+  CopyName(
+      event.function_name,
+      shared->DebugName()->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL)
+          .get());
+  event.script_name[0] = '\0';
+  event.script_id = -1;
+  if (shared->script()->IsScript()) {
+    Script* script = Script::cast(shared->script());
+    event.script_id = script->id();
+    if (script->name()->IsString()) {
+      CopyName(event.script_name,
+               String::cast(script->name())
+                   ->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL)
+                   .get());
+    }
+  }
+  event.function_position = shared->start_position();
+  event.bytecode_offset = bytecode_offset;
+  event.reason = reason;
+  event.bailout_type = bailout_type;
+  event.timestamp = timestamp;
+  event.count = 1;
+
+  if (events_.size() < capacity_) {
+    events_.push_back(event);
+  } else {
+    events_[next_event_] = event;
+    next_event_ = (next_event_ + 1) % capacity_;
+  }
+
+  SiteKey key;
+  key.script_id = event.script_id;
+  key.function_position = event.function_position;
+  key.bytecode_offset = event.bytecode_offset;
+  key.reason = event.reason;
+  key.bailout_type = event.bailout_type;
+  memcpy(key.function_name, event.function_name, sizeof(key.function_name));
+  auto it = sites_.find(key);
+  if (it != sites_.end()) {
+    it->second.count++;
+    it->second.timestamp = timestamp;
+  } else if (sites_.size() < kMaxSites) {
+    sites_.insert(std::make_pair(key, event));
+  }
+}
+
+const DeoptimizationLog::Event& DeoptimizationLog::event(size_t index) const {
+  DCHECK_LT(index, events_.size());
+  return events_[(next_event_ + index) % events_.size()];
+}
+
+std::vector<DeoptimizationLog::Event> DeoptimizationLog::GetTopSites(
+    size_t limit) const {
+  std::vector<Event> sites;
+  sites.reserve(sites_.size());
+  for (const auto& entry : sites_) sites.push_back(entry.second);
+  limit = std::min(limit, sites.size());
+  std::partial_sort(sites.begin(), sites.begin() + limit, sites.end(),
+                    [](const Event& a, const Event& b) {
+                      if (a.count != b.count) return a.count > b.count;
+                      return a.timestamp > b.timestamp;
+                    });
+  sites.resize(limit);
+  return sites;
+}
+
+void DeoptimizationLog::Clear() {
+  events_.clear();
+  next_event_ = 0;
+  sites_.clear();
+}
+
+}  // namespace internal
+}  // namespace v8
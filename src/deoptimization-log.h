@@ -0,0 +1,97 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZATION_LOG_H_
+#define V8_DEOPTIMIZATION_LOG_H_
+
+#include <map>
+#include <vector>
+
+#include "src/allocation.h"
+#include "src/deoptimize-reason.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+
+// Records the deoptimizations in an isolate for the embedder, which polls
+// them through the v8::Isolate API. The log keeps a bounded buffer of the
+// most recent deoptimizations and counts them per deoptimization site, so
+// that deopt loops show up as the most frequent sites. Nothing is done until
+// code is deoptimized, and recording does not allocate on the JavaScript
+// heap. Names are copied into the events, so the memory used by the log is
+// bounded no matter how many different functions deoptimize.
+class DeoptimizationLog {
+ public:
+  // Longer function and script names are truncated.
+  static const size_t kMaxNameLength = 127;
+
+  struct Event {
+    char function_name[kMaxNameLength + 1];
+    char script_name[kMaxNameLength + 1];
+    int script_id;
+    int function_position;
+    // The bytecode offset of the deoptimization in the function, or -1 if
+    // execution does not continue in the interpreter.
+    int bytecode_offset;
+    DeoptimizeReason reason;
+    // "eager", "soft" or "lazy".
+    const char* bailout_type;
+    // The time of the last deoptimization in milliseconds since the isolate
+    // was initialized.
+    double timestamp;
+    // The number of deoptimizations at this site, 1 for single events.
+    size_t count;
+  };
+
+  // Keeps the {capacity} most recent events.
+  explicit DeoptimizationLog(size_t capacity);
+
+  // Records a deoptimization in {shared}, which is the innermost function of
+  // the deoptimized frame in case of inlining.
+  void Record(SharedFunctionInfo* shared, int bytecode_offset,
+              DeoptimizeReason reason, const char* bailout_type,
+              double timestamp);
+
+  // The recorded events from the oldest to the most recent one.
+  size_t event_count() const { return events_.size(); }
+  const Event& event(size_t index) const;
+
+  // Returns up to {limit} deoptimization sites, most frequent first.
+  std::vector<Event> GetTopSites(size_t limit) const;
+
+  void Clear();
+
+  // Sites beyond this number are not counted, but still show up as events.
+  static const size_t kMaxSites = 1024;
+
+ private:
+  struct SiteKey {
+    int script_id;
+    int function_position;
+    int bytecode_offset;
+    DeoptimizeReason reason;
+    const char* bailout_type;
+    // Tells apart functions without a script.
+    char function_name[kMaxNameLength + 1];
+
+    bool operator<(const SiteKey& other) const;
+  };
+
+  static void CopyName(char* destination, const char* source);
+
+  size_t capacity_;
+  // Ring buffer of events, {next_event_} is the oldest once it is full.
+  std::vector<Event> events_;
+  size_t next_event_;
+  std::map<SiteKey, Event> sites_;
+
+  DISALLOW_COPY_AND_ASSIGN(DeoptimizationLog);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZATION_LOG_H_
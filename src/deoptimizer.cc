@@ -9,6 +9,7 @@
 #include "src/accessors.h"
 #include "src/ast/prettyprinter.h"
 #include "src/codegen.h"
+#include "src/deoptimization-log.h"
 #include "src/disasm.h"
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
@@ -403,6 +404,11 @@ void Deoptimizer::DeoptimizeFunction(JSFunction* function, Code* code) {
     // so we only need to search one.
     code->set_marked_for_deoptimization(true);
     DeoptimizeMarkedCodeForContext(function->context()->native_context());
+    // Code without deoptimization support (e.g. non-speculative code) is not
+    // on the optimized code list, so it has to be unlinked here.
+    if (function->code() == code) {
+      function->ReplaceCode(function->shared()->code());
+    }
   }
 }
 
@@ -651,6 +657,27 @@ int LookupCatchHandler(TranslatedFrame* translated_frame, int* data_out) {
 
 }  // namespace
 
+void Deoptimizer::RecordDeoptimization() {
+  // Attribute the deoptimization to the innermost function, which differs
+  // from the optimized one if the deoptimization happens in inlined code.
+  const std::vector<TranslatedFrame>& frames = translated_state_.frames();
+  for (size_t i = frames.size(); i-- > 0;) {
+    const TranslatedFrame& frame = frames[i];
+    if (frame.kind() != TranslatedFrame::kFunction &&
+        frame.kind() != TranslatedFrame::kInterpretedFunction) {
+      continue;
+    }
+    int bytecode_offset = frame.kind() == TranslatedFrame::kInterpretedFunction
+                              ? frame.node_id().ToInt()
+                              : -1;
+    DeoptInfo info = GetDeoptInfo(compiled_code_, from_);
+    isolate_->deoptimization_log()->Record(
+        frame.raw_shared_info(), bytecode_offset, info.deopt_reason,
+        MessageFor(bailout_type_), isolate_->time_millis_since_init());
+    return;
+  }
+}
+
 // We rely on this function not causing a GC.  It is called from generated code
 // without having a real stack frame in place.
 void Deoptimizer::DoComputeOutputFrames() {
@@ -710,6 +737,11 @@ void Deoptimizer::DoComputeOutputFrames() {
       input_data->LiteralArray(), input_->GetRegisterValues(),
       trace_scope_ == nullptr ? nullptr : trace_scope_->file());
 
+  if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION &&
+      function_ != nullptr) {
+    RecordDeoptimization();
+  }
+
   // Do the input frame to output frame(s) translation.
   size_t count = translated_state_.frames().size();
   // If we are supposed to go to the catch handler, find the catching frame
@@ -517,6 +517,8 @@ class Deoptimizer : public Malloced {
               unsigned bailout_id, Address from, int fp_to_sp_delta);
   Code* FindOptimizedCode(JSFunction* function);
   void PrintFunctionName();
+  // Records the deoptimization in the deoptimization log of the isolate.
+  void RecordDeoptimization();
   void DeleteFrameDescriptions();
 
   void DoComputeOutputFrames();
@@ -1218,6 +1218,43 @@ class ElementsAccessorBase : public ElementsAccessor {
                                       length);
   }
 
+  static Maybe<int64_t> LastIndexOfValueImpl(Isolate* isolate,
+                                             Handle<JSObject> receiver,
+                                             Handle<Object> value,
+                                             uint32_t start_from) {
+    UNREACHABLE();
+    return Just<int64_t>(-1);
+  }
+
+  Maybe<int64_t> LastIndexOfValue(Isolate* isolate, Handle<JSObject> receiver,
+                                  Handle<Object> value,
+                                  uint32_t start_from) final {
+    return Subclass::LastIndexOfValueImpl(isolate, receiver, value,
+                                          start_from);
+  }
+
+  static void FillImpl(Handle<JSObject> receiver, Handle<Object> value,
+                       uint32_t start, uint32_t end) {
+    UNREACHABLE();
+  }
+
+  void Fill(Handle<JSObject> receiver, Handle<Object> value, uint32_t start,
+            uint32_t end) final {
+    Subclass::FillImpl(receiver, value, start, end);
+  }
+
+  static void CopyTypedArrayElementsImpl(Handle<JSTypedArray> source,
+                                         Handle<JSObject> destination,
+                                         uint32_t offset) {
+    UNREACHABLE();
+  }
+
+  void CopyTypedArrayElements(Handle<JSTypedArray> source,
+                              Handle<JSObject> destination,
+                              uint32_t offset) final {
+    Subclass::CopyTypedArrayElementsImpl(source, destination, offset);
+  }
+
   static uint32_t GetIndexForEntryImpl(FixedArrayBase* backing_store,
                                        uint32_t entry) {
     return entry;
@@ -2863,7 +2900,8 @@ class TypedElementsAccessor
                                          Handle<JSObject> receiver,
                                          Handle<Object> value,
                                          uint32_t start_from, uint32_t length) {
-    DCHECK(JSObject::PrototypeHasNoElements(isolate, *receiver));
+    // Integer-indexed exotic objects never look up elements on their
+    // prototype chain, so there is nothing to check there.
     DisallowHeapAllocation no_gc;
 
     BackingStore* elements = BackingStore::cast(receiver->elements());
@@ -2904,6 +2942,132 @@ class TypedElementsAccessor
     }
     return Just<int64_t>(-1);
   }
+
+  static Maybe<int64_t> LastIndexOfValueImpl(Isolate* isolate,
+                                             Handle<JSObject> receiver,
+                                             Handle<Object> value,
+                                             uint32_t start_from) {
+    DisallowHeapAllocation no_gc;
+    DCHECK(!JSArrayBufferView::cast(*receiver)->WasNeutered());
+
+    BackingStore* elements = BackingStore::cast(receiver->elements());
+    if (!value->IsNumber()) return Just<int64_t>(-1);
+
+    double search_value = value->Number();
+
+    if (!std::isfinite(search_value)) {
+      // Integral types cannot represent +Inf or NaN.
+      if (AccessorClass::kind() < FLOAT32_ELEMENTS ||
+          AccessorClass::kind() > FLOAT64_ELEMENTS) {
+        return Just<int64_t>(-1);
+      }
+    } else if (search_value < std::numeric_limits<ctype>::lowest() ||
+               search_value > std::numeric_limits<ctype>::max()) {
+      // Return -1 if value can't be represented in this ElementsKind.
+      return Just<int64_t>(-1);
+    }
+
+    if (std::isnan(search_value)) {
+      return Just<int64_t>(-1);
+    }
+
+    ctype typed_search_value = static_cast<ctype>(search_value);
+    if (static_cast<double>(typed_search_value) != search_value) {
+      return Just<int64_t>(-1);  // Loss of precision.
+    }
+
+    DCHECK_LT(start_from, static_cast<uint32_t>(elements->length()));
+    ctype* data = static_cast<ctype*>(elements->DataPtr());
+    uint32_t k = start_from;
+    do {
+      if (data[k] == typed_search_value) return Just<int64_t>(k);
+    } while (k-- > 0);
+    return Just<int64_t>(-1);
+  }
+
+  static void FillImpl(Handle<JSObject> receiver, Handle<Object> value,
+                       uint32_t start, uint32_t end) {
+    DisallowHeapAllocation no_gc;
+    DCHECK(value->IsNumber());
+    DCHECK(!JSArrayBufferView::cast(*receiver)->WasNeutered());
+
+    BackingStore* elements = BackingStore::cast(receiver->elements());
+    DCHECK_LE(start, end);
+    DCHECK_LE(end, static_cast<uint32_t>(elements->length()));
+    // Convert the value once instead of per element, the loop over the raw
+    // backing store is then simple enough for the C++ compiler to vectorize.
+    ctype scalar = value->IsSmi()
+                       ? BackingStore::from_int(Smi::cast(*value)->value())
+                       : BackingStore::from_double(value->Number());
+    ctype* data = static_cast<ctype*>(elements->DataPtr());
+    std::fill(data + start, data + end, scalar);
+  }
+
+  // Conversions of a source element to the element type of this accessor,
+  // matching the conversion of the Number value of the source element.
+  static ctype FromScalar(int value) { return BackingStore::from_int(value); }
+  static ctype FromScalar(uint32_t value) {
+    return BackingStore::from_double(value);
+  }
+  static ctype FromScalar(double value) {
+    return BackingStore::from_double(value);
+  }
+
+  template <typename SourceTraits>
+  static void CopyTypedArrayElementsFrom(JSTypedArray* source,
+                                         JSObject* destination,
+                                         uint32_t offset) {
+    typedef typename SourceTraits::ElementType source_ctype;
+    typedef FixedTypedArray<SourceTraits> SourceBackingStore;
+    DisallowHeapAllocation no_gc;
+
+    uint32_t length = source->length_value();
+    if (length == 0) return;
+    SourceBackingStore* source_elements =
+        SourceBackingStore::cast(source->elements());
+    BackingStore* destination_elements =
+        BackingStore::cast(destination->elements());
+    DCHECK_LE(offset + length,
+              static_cast<uint32_t>(destination_elements->length()));
+
+    source_ctype* source_data =
+        static_cast<source_ctype*>(source_elements->DataPtr());
+    ctype* destination_data =
+        static_cast<ctype*>(destination_elements->DataPtr()) + offset;
+
+    // If the arrays share memory, read from a copy of the source so that
+    // every element is converted from its original value.
+    std::unique_ptr<source_ctype[]> source_copy;
+    uint8_t* source_begin = reinterpret_cast<uint8_t*>(source_data);
+    uint8_t* source_end = reinterpret_cast<uint8_t*>(source_data + length);
+    uint8_t* destination_begin = reinterpret_cast<uint8_t*>(destination_data);
+    uint8_t* destination_end =
+        reinterpret_cast<uint8_t*>(destination_data + length);
+    if (source_begin < destination_end && destination_begin < source_end) {
+      source_copy.reset(new source_ctype[length]);
+      MemCopy(source_copy.get(), source_data, length * sizeof(source_ctype));
+      source_data = source_copy.get();
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+      destination_data[i] = FromScalar(source_data[i]);
+    }
+  }
+
+  static void CopyTypedArrayElementsImpl(Handle<JSTypedArray> source,
+                                         Handle<JSObject> destination,
+                                         uint32_t offset) {
+    DCHECK(destination->IsJSTypedArray());
+    switch (source->type()) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, source_ctype, size)              \
+  case kExternal##Type##Array:                                              \
+    CopyTypedArrayElementsFrom<Type##ArrayTraits>(*source, *destination,    \
+                                                  offset);                  \
+    break;
+      TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+    }
+  }
 };
 
 #define FIXED_ELEMENTS_ACCESSOR(Type, type, TYPE, ctype, size) \
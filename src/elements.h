@@ -171,6 +171,25 @@ class ElementsAccessor {
                                       Handle<Object> value, uint32_t start,
                                       uint32_t length) = 0;
 
+  // Check a typed array's elements for the last index of an element (using
+  // strict equality), searching backwards from index |start|.
+  virtual Maybe<int64_t> LastIndexOfValue(Isolate* isolate,
+                                          Handle<JSObject> receiver,
+                                          Handle<Object> value,
+                                          uint32_t start) = 0;
+
+  // Fills the elements of a typed array in [start, end) with the Number
+  // |value|, converted once to the element type.
+  virtual void Fill(Handle<JSObject> receiver, Handle<Object> value,
+                    uint32_t start, uint32_t end) = 0;
+
+  // Copies all elements of the typed array |source| into the typed array
+  // |destination| starting at index |offset|, converting each element to the
+  // element type of |destination|. The two arrays may share a buffer.
+  virtual void CopyTypedArrayElements(Handle<JSTypedArray> source,
+                                      Handle<JSObject> destination,
+                                      uint32_t offset) = 0;
+
   virtual void CopyElements(Handle<FixedArrayBase> source,
                             ElementsKind source_kind,
                             Handle<FixedArrayBase> destination, int size) = 0;
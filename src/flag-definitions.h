@@ -127,6 +127,13 @@ struct MaybeBoolFlag {
 #define DEBUG_BOOL false
 #endif
 
+// The instruction scheduler has latency models tuned for these targets.
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+#define TURBO_INSTRUCTION_SCHEDULING_BOOL true
+#else
+#define TURBO_INSTRUCTION_SCHEDULING_BOOL false
+#endif
+
 // Supported ARM configurations are:
 //  "armv6":       ARMv6 + VFPv2
 //  "armv7":       ARMv7 + VFPv3-D32 + NEON
@@ -307,6 +314,8 @@ DEFINE_BOOL(ignition_deadcode, true,
 DEFINE_BOOL(ignition_osr, true, "enable support for OSR from ignition code")
 DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse frequent bytecode sequences into superinstructions")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(print_bytecode, false,
@@ -341,6 +350,9 @@ DEFINE_INT(max_inlined_nodes, 200,
            "maximum number of AST nodes considered for a single inlining")
 DEFINE_INT(max_inlined_nodes_cumulative, 400,
            "maximum cumulative number of AST nodes considered for inlining")
+DEFINE_FLOAT(min_inlining_frequency, 0.0,
+             "minimum relative call frequency for a call site to be inlined "
+             "(0 considers all call sites)")
 DEFINE_BOOL(loop_invariant_code_motion, true, "loop invariant code motion")
 DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(collect_megamorphic_maps_from_stub_cache, false,
@@ -421,6 +433,9 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile on-stack replacement code from ignition concurrently")
+DEFINE_IMPLICATION(concurrent_osr, ignition_osr)
 
 DEFINE_BOOL(omit_map_checks_for_leaf_maps, true,
             "do not emit check maps for constant values that have a leaf map, "
@@ -463,6 +478,9 @@ DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
+DEFINE_BOOL(turbo_baseline, false,
+            "compile hot functions that deoptimized too often from bytecode "
+            "with TurboFan, without speculation (experimental)")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
 DEFINE_BOOL(turbo_load_elimination, true, "enable load elimination in TurboFan")
 DEFINE_BOOL(trace_turbo_load_elimination, false,
@@ -479,7 +497,7 @@ DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_escape, false, "enable escape analysis")
 DEFINE_IMPLICATION(turbo, turbo_escape)
-DEFINE_BOOL(turbo_instruction_scheduling, false,
+DEFINE_BOOL(turbo_instruction_scheduling, TURBO_INSTRUCTION_SCHEDULING_BOOL,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
@@ -590,7 +608,8 @@ DEFINE_BOOL(enable_vldr_imm, false,
             "enable use of constant pools for double immediate (ARM only)")
 DEFINE_BOOL(force_long_branches, false,
             "force all emitted branches to be in long mode (MIPS/PPC only)")
-DEFINE_STRING(mcpu, "auto", "enable optimization for specific cpu")
+DEFINE_STRING(mcpu, "auto",
+              "enable optimization for specific cpu (auto, atom, cortex-a53)")
 
 // Deprecated ARM flags (replaced by arm_arch).
 DEFINE_MAYBE_BOOL(enable_armv7, "deprecated (use --arm_arch instead)")
@@ -646,6 +665,8 @@ DEFINE_BOOL(always_opt, false, "always try to optimize functions")
 DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 DEFINE_BOOL(trace_deopt, false, "trace optimize function deoptimization")
+DEFINE_INT(deopt_log_size, 256,
+           "number of recent deoptimizations kept for the embedder")
 DEFINE_BOOL(trace_stub_failures, false,
             "trace deoptimization of generated code stubs")
 
@@ -751,6 +772,9 @@ DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
 DEFINE_BOOL(weak_embedded_objects_in_optimized_code, true,
             "make objects embedded in optimized code weak")
 DEFINE_BOOL(flush_code, true, "flush code that we expect not to use again")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush bytecode of functions that were not executed recently "
+            "(requires code flushing)")
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
@@ -828,6 +852,11 @@ DEFINE_BOOL(trace_ic, false, "trace inline cache state transitions")
 DEFINE_INT(ic_stats, 0, "inline cache state transitions statistics")
 DEFINE_VALUE_IMPLICATION(trace_ic, ic_stats, 1)
 
+// stub-cache.cc
+DEFINE_BOOL(adaptive_stub_cache, true,
+            "grow the megamorphic stub caches when they miss frequently")
+DEFINE_BOOL(trace_stub_cache, false, "trace megamorphic stub cache resizing")
+
 // macro-assembler-ia32.cc
 DEFINE_BOOL(native_code_counters, false,
             "generate extra code for manipulating stats counters")
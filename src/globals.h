@@ -780,6 +780,7 @@ enum CpuFeature {
   MIPSr6,
   // ARM64
   ALWAYS_ALIGN_CSP,
+  IN_ORDER_CORE,  // In-order pipeline, e.g. Cortex-A53.
   // PPC
   FPR_GPR_MOV,
   LWSYNC,
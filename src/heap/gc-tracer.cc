@@ -29,10 +29,10 @@ GCTracer::Scope::Scope(GCTracer* tracer, ScopeId scope)
   STATIC_ASSERT(FIRST_INCREMENTAL_SCOPE == 0);
   start_time_ = tracer_->heap_->MonotonicallyIncreasingTimeInMs();
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Enter(
-        tracer_->heap_->isolate()->counters()->runtime_call_stats(), &timer_,
-        &RuntimeCallStats::GC);
+  RuntimeCallStats* stats =
+      tracer_->heap_->isolate()->counters()->runtime_call_stats();
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
+    RuntimeCallStats::Enter(stats, &timer_, &RuntimeCallStats::GC);
   }
 }
 
@@ -40,9 +40,10 @@ GCTracer::Scope::~Scope() {
   tracer_->AddScopeSample(
       scope_, tracer_->heap_->MonotonicallyIncreasingTimeInMs() - start_time_);
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Leave(
-        tracer_->heap_->isolate()->counters()->runtime_call_stats(), &timer_);
+  RuntimeCallStats* stats =
+      tracer_->heap_->isolate()->counters()->runtime_call_stats();
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
+    RuntimeCallStats::Leave(stats, &timer_);
   }
 }
 
@@ -112,8 +113,13 @@ GCTracer::GCTracer(Heap* heap)
       new_space_allocation_in_bytes_since_gc_(0),
       old_generation_allocation_in_bytes_since_gc_(0),
       combined_mark_compact_speed_cache_(0.0),
-      start_counter_(0) {
+      start_counter_(0),
+      pause_callback_(nullptr),
+      pause_callback_data_(nullptr) {
   current_.end_time = heap_->MonotonicallyIncreasingTimeInMs();
+  for (int i = 0; i < kNumberOfPauseHistograms; i++) {
+    pause_times_[i] = 0;
+  }
 }
 
 void GCTracer::ResetForTesting() {
@@ -135,8 +141,10 @@ void GCTracer::ResetForTesting() {
   recorded_incremental_mark_compacts_.Reset();
   recorded_new_generation_allocations_.Reset();
   recorded_old_generation_allocations_.Reset();
+  recorded_promotions_.Reset();
   recorded_context_disposal_times_.Reset();
   recorded_survival_ratios_.Reset();
+  ResetPauseHistograms();
   start_counter_ = 0;
 }
 
@@ -197,9 +205,9 @@ void GCTracer::Start(GarbageCollector collector,
                                                           committed_memory);
   counters->aggregated_memory_heap_used()->AddSample(start_time, used_memory);
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Enter(heap_->isolate()->counters()->runtime_call_stats(),
-                            &timer_, &RuntimeCallStats::GC);
+  RuntimeCallStats* stats = heap_->isolate()->counters()->runtime_call_stats();
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
+    RuntimeCallStats::Enter(stats, &timer_, &RuntimeCallStats::GC);
   }
 }
 
@@ -234,6 +242,12 @@ void GCTracer::Stop(GarbageCollector collector) {
   current_.end_holes_size = CountTotalHolesSize(heap_);
   current_.survived_new_space_object_size = heap_->SurvivedNewSpaceObjectSize();
 
+  // Promotions are attributed to the mutator time since the last GC, which
+  // AddAllocation consumes.
+  if (allocation_duration_since_gc_ > 0) {
+    recorded_promotions_.Push(MakeBytesAndDuration(
+        heap_->promoted_objects_size(), allocation_duration_since_gc_));
+  }
   AddAllocation(current_.end_time);
 
   size_t committed_memory = heap_->CommittedMemory() / KB;
@@ -280,6 +294,7 @@ void GCTracer::Stop(GarbageCollector collector) {
   }
 
   heap_->UpdateTotalGCTime(duration);
+  RecordPauses(duration);
 
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
@@ -297,9 +312,9 @@ void GCTracer::Stop(GarbageCollector collector) {
   }
 
   // TODO(cbruni): remove once we fully moved to a trace-based system.
-  if (V8_UNLIKELY(FLAG_runtime_stats)) {
-    RuntimeCallStats::Leave(heap_->isolate()->counters()->runtime_call_stats(),
-                            &timer_);
+  RuntimeCallStats* stats = heap_->isolate()->counters()->runtime_call_stats();
+  if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(stats))) {
+    RuntimeCallStats::Leave(stats, &timer_);
   }
 }
 
@@ -347,6 +362,75 @@ void GCTracer::AddAllocation(double current_ms) {
 }
 
 
+void GCTracer::RecordPause(int index, double duration) {
+  DCHECK(index < kNumberOfPauseHistograms);
+  if (!pause_histograms_[index]) {
+    pause_histograms_[index].reset(new RuntimeCallHistogram());
+  }
+  int64_t microseconds = static_cast<int64_t>(
+      duration * base::Time::kMicrosecondsPerMillisecond);
+  pause_histograms_[index]->AddSample(
+      base::TimeDelta::FromMicroseconds(microseconds));
+}
+
+void GCTracer::RecordPauses(double duration) {
+  // Incremental marking steps were recorded as they happened.
+  for (int i = Scope::LAST_INCREMENTAL_SCOPE + 1; i < Scope::NUMBER_OF_SCOPES;
+       i++) {
+    if (current_.scopes[i] > 0) RecordPause(i, current_.scopes[i]);
+  }
+  int event_index = Scope::NUMBER_OF_SCOPES + current_.type;
+  RecordPause(event_index, duration);
+  if (pause_callback_ == nullptr) return;
+
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    pause_times_[i] = static_cast<size_t>(
+        current_.scopes[i] * base::Time::kMicrosecondsPerMillisecond);
+  }
+  for (int i = Scope::NUMBER_OF_SCOPES; i < kNumberOfPauseHistograms; i++) {
+    pause_times_[i] = 0;
+  }
+  pause_times_[event_index] = static_cast<size_t>(
+      duration * base::Time::kMicrosecondsPerMillisecond);
+
+  v8::GCPauseInfo info;
+  info.type = (current_.type == Event::SCAVENGER ||
+               current_.type == Event::MINOR_MARK_COMPACTOR)
+                  ? kGCTypeScavenge
+                  : kGCTypeMarkSweepCompact;
+  info.pause_time = pause_times_[event_index];
+  info.scope_times = pause_times_;
+  info.scope_count = kNumberOfPauseHistograms;
+  info.promoted_bytes = heap_->promoted_objects_size();
+  pause_callback_(reinterpret_cast<v8::Isolate*>(heap_->isolate()), info,
+                  pause_callback_data_);
+}
+
+void GCTracer::ResetPauseHistograms() {
+  for (int i = 0; i < kNumberOfPauseHistograms; i++) {
+    if (pause_histograms_[i]) pause_histograms_[i]->Reset();
+  }
+}
+
+const char* GCTracer::PauseHistogramName(int index) {
+  DCHECK(index < kNumberOfPauseHistograms);
+  if (index < Scope::NUMBER_OF_SCOPES) {
+    return Scope::Name(static_cast<Scope::ScopeId>(index));
+  }
+  // Named like the histogram timers of Heap::GCTypeTimer.
+  switch (index - Scope::NUMBER_OF_SCOPES) {
+    case Event::SCAVENGER:
+      return "V8.GCScavenger";
+    case Event::MARK_COMPACTOR:
+      return "V8.GCCompactor";
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+      return "V8.GCFinalizeMC";
+    case Event::MINOR_MARK_COMPACTOR:
+      return "V8.GCMinorMC";
+  }
+  return "(unknown)";
+}
+
 void GCTracer::AddContextDisposalTime(double time) {
   recorded_context_disposal_times_.Push(time);
 }
@@ -808,6 +892,16 @@ double GCTracer::CurrentOldGenerationAllocationThroughputInBytesPerMillisecond()
       kThroughputTimeFrameMs);
 }
 
+double GCTracer::PromotionThroughputInBytesPerMillisecond(
+    double time_ms) const {
+  return AverageSpeed(recorded_promotions_, MakeBytesAndDuration(0, 0),
+                      time_ms);
+}
+
+double GCTracer::CurrentPromotionThroughputInBytesPerMillisecond() const {
+  return PromotionThroughputInBytesPerMillisecond(kThroughputTimeFrameMs);
+}
+
 double GCTracer::ContextDisposalRateInMilliseconds() const {
   if (recorded_context_disposal_times_.Count() <
       recorded_context_disposal_times_.kSize)
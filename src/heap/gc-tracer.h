@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <memory>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -225,6 +227,11 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   static const int kThroughputTimeFrameMs = 5000;
 
+  // Pause time histograms are kept for every scope, followed by one for the
+  // whole pause of each type of event.
+  static const int kNumberOfPauseHistograms =
+      Scope::NUMBER_OF_SCOPES + Event::START;
+
   explicit GCTracer(Heap* heap);
 
   // Start collecting data.
@@ -302,6 +309,16 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns 0 if no allocation events have been recorded.
   double CurrentOldGenerationAllocationThroughputInBytesPerMillisecond() const;
 
+  // Bytes promoted to the old generation per millisecond of mutator time in
+  // the last time_ms milliseconds.
+  // Returns 0 if no events have been recorded.
+  double PromotionThroughputInBytesPerMillisecond(double time_ms = 0) const;
+
+  // Bytes promoted to the old generation per millisecond of mutator time in
+  // the last kThroughputTimeFrameMs seconds.
+  // Returns 0 if no events have been recorded.
+  double CurrentPromotionThroughputInBytesPerMillisecond() const;
+
   // Computes the context disposal rate in milliseconds. It takes the time
   // frame of the first recorded context disposal to the current time and
   // divides it by the number of recorded events.
@@ -321,12 +338,31 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void NotifyIncrementalMarkingStart();
 
+  static const char* PauseHistogramName(int index);
+
+  // Returns nullptr if no pause was recorded for {index} yet.
+  RuntimeCallHistogram* pause_histogram(int index) const {
+    DCHECK(index < kNumberOfPauseHistograms);
+    return pause_histograms_[index].get();
+  }
+
+  void ResetPauseHistograms();
+
+  // The callback is invoked at the end of every GC, while heap allocation is
+  // still disallowed.
+  void SetPauseCallback(v8::GCPauseCallback callback, void* data) {
+    pause_callback_ = callback;
+    pause_callback_data_ = data;
+  }
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
         scope <= Scope::LAST_INCREMENTAL_SCOPE) {
       incremental_marking_scopes_[scope - Scope::FIRST_INCREMENTAL_SCOPE]
           .Update(duration);
+      // Incremental marking steps are pauses of their own.
+      RecordPause(scope, duration);
     } else {
       current_.scopes[scope] += duration;
     }
@@ -342,6 +378,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
+  FRIEND_TEST(GCTracerTest, PauseHistograms);
 
   // Returns the average speed of the events in the buffer.
   // If the buffer is empty, the result is 0.
@@ -354,6 +391,11 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ResetIncrementalMarkingCounters();
   void RecordIncrementalMarkingSpeed(size_t bytes, double duration);
 
+  void RecordPause(int index, double duration);
+  // Records the scopes of the current event in the pause histograms and
+  // reports them to the pause callback.
+  void RecordPauses(double duration);
+
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
@@ -427,9 +469,20 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::RingBuffer<BytesAndDuration> recorded_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_new_generation_allocations_;
   base::RingBuffer<BytesAndDuration> recorded_old_generation_allocations_;
+  base::RingBuffer<BytesAndDuration> recorded_promotions_;
   base::RingBuffer<double> recorded_context_disposal_times_;
   base::RingBuffer<double> recorded_survival_ratios_;
 
+  // Allocated when the first pause is recorded for a histogram.
+  std::unique_ptr<RuntimeCallHistogram>
+      pause_histograms_[kNumberOfPauseHistograms];
+
+  v8::GCPauseCallback pause_callback_;
+  void* pause_callback_data_;
+  // Time spent in each pause histogram during the current event, in
+  // microseconds, as passed to the pause callback.
+  size_t pause_times_[kNumberOfPauseHistograms];
+
   DISALLOW_COPY_AND_ASSIGN(GCTracer);
 };
 }  // namespace internal
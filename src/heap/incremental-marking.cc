@@ -182,6 +182,9 @@ class IncrementalMarkingMarkingVisitor
     table_.Register(kVisitNativeContext, &VisitNativeContextIncremental);
   }
 
+  using StaticMarkingVisitor<
+      IncrementalMarkingMarkingVisitor>::MarkBytecodeForDeoptimization;
+
   static const int kProgressBarScanningChunk = 32 * 1024;
 
   static void VisitFixedArrayIncremental(Map* map, HeapObject* object) {
@@ -289,6 +292,15 @@ void IncrementalMarking::IterateBlackObject(HeapObject* object) {
   }
 }
 
+void IncrementalMarking::MarkBytecodeForDeoptimization(Code* code) {
+  if (FLAG_flush_bytecode && IsMarking() &&
+      heap_->mark_compact_collector()->is_code_flushing_enabled() &&
+      Marking::IsBlack(ObjectMarking::MarkBitFrom(code))) {
+    IncrementalMarkingMarkingVisitor::MarkBytecodeForDeoptimization(heap_,
+                                                                    code);
+  }
+}
+
 class IncrementalMarkingRootMarkingVisitor : public ObjectVisitor {
  public:
   explicit IncrementalMarkingRootMarkingVisitor(
@@ -210,6 +210,10 @@ class IncrementalMarking {
 
   void IterateBlackObject(HeapObject* object);
 
+  // Optimized code allocated black is never visited, so the bytecode it
+  // deoptimizes into has to be marked once the code is complete.
+  void MarkBytecodeForDeoptimization(Code* code);
+
   Heap* heap() const { return heap_; }
 
   IncrementalMarkingJob* incremental_marking_job() {
@@ -8,6 +8,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/heap/remembered-set.h"
 #include "src/isolate.h"
+#include "src/list-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -79,6 +80,13 @@ void CodeFlusher::AddCandidate(SharedFunctionInfo* shared_info) {
 }
 
 
+void CodeFlusher::AddBytecodeCandidate(SharedFunctionInfo* shared_info) {
+  DCHECK(shared_info->IsInterpreted());
+  DCHECK(!isolate_->heap()->InNewSpace(shared_info));
+  bytecode_candidates_.Add(shared_info);
+}
+
+
 void CodeFlusher::AddCandidate(JSFunction* function) {
   DCHECK(function->code() == function->shared()->code());
   if (function->next_function_link()->IsUndefined(isolate_)) {
@@ -991,6 +991,67 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
   shared_function_info_candidates_head_ = NULL;
 }
 
+void CodeFlusher::ProcessBytecodeCandidates() {
+  for (int i = 0; i < bytecode_candidates_.length(); i++) {
+    SharedFunctionInfo* candidate = bytecode_candidates_[i];
+    // A candidate that was added twice has been flushed already, one that
+    // was evicted is no longer interpreted.
+    if (!candidate->IsInterpreted()) continue;
+    DCHECK(candidate->HasBytecodeArray());
+    FlushBytecodeIfUnmarked(candidate);
+  }
+  bytecode_candidates_.Clear();
+}
+
+void CodeFlusher::FlushBytecodeIfUnmarked(SharedFunctionInfo* candidate) {
+  Code* lazy_compile = isolate_->builtins()->builtin(Builtins::kCompileLazy);
+  BytecodeArray* bytecode = candidate->bytecode_array();
+  MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+  if (Marking::IsWhite(bytecode_mark)) {
+    if (FLAG_trace_code_flushing) {
+      PrintF("[code-flushing clears bytecode: ");
+      candidate->ShortPrint();
+      PrintF(" - size: %d]\n", bytecode->Size());
+    }
+    isolate_->counters()->total_flushed_bytecode_size()->Increment(
+        bytecode->Size());
+    // Always flush the optimized code map if there is one.
+    if (!candidate->OptimizedCodeMapIsCleared()) {
+      candidate->ClearOptimizedCodeMap();
+    }
+    // Closures still pointing at the trampoline are reset when the closure
+    // candidates are processed, all others go through CompileLazy anyway.
+    candidate->ClearBytecodeArray();
+    candidate->set_code(lazy_compile);
+  }
+
+  // We are in the middle of a GC cycle so the write barrier in the setters
+  // did not record the slot updates and we have to do that manually.
+  Object** data_slot =
+      HeapObject::RawField(candidate, SharedFunctionInfo::kFunctionDataOffset);
+  isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, data_slot,
+                                                         *data_slot);
+  Object** code_slot =
+      HeapObject::RawField(candidate, SharedFunctionInfo::kCodeOffset);
+  isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, code_slot,
+                                                         *code_slot);
+}
+
+void CodeFlusher::EvictBytecodeCandidate(SharedFunctionInfo* shared_info) {
+  // The candidate stays in the list, ProcessBytecodeCandidates() skips it
+  // once it is no longer interpreted.
+  if (bytecode_candidates_.is_empty()) return;
+
+  // Make sure previous flushing decisions are revisited.
+  isolate_->heap()->incremental_marking()->IterateBlackObject(shared_info);
+
+  if (FLAG_trace_code_flushing) {
+    PrintF("[code-flushing abandons bytecode: ");
+    shared_info->ShortPrint();
+    PrintF("]\n");
+  }
+}
+
 
 void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
   // Make sure previous flushing decisions are revisited.
@@ -1315,6 +1376,10 @@ class SharedFunctionInfoMarkingVisitor : public ObjectVisitor {
       MarkBit shared_mark = ObjectMarking::MarkBitFrom(shared);
       MarkBit code_mark = ObjectMarking::MarkBitFrom(shared->code());
       collector_->MarkObject(shared->code(), code_mark);
+      if (shared->HasBytecodeArray()) {
+        BytecodeArray* bytecode = shared->bytecode_array();
+        collector_->MarkObject(bytecode, ObjectMarking::MarkBitFrom(bytecode));
+      }
       collector_->MarkObject(shared, shared_mark);
     }
   }
@@ -13,6 +13,7 @@
 #include "src/heap/marking.h"
 #include "src/heap/spaces.h"
 #include "src/heap/store-buffer.h"
+#include "src/list.h"
 
 namespace v8 {
 namespace internal {
@@ -204,11 +205,14 @@ class CodeFlusher {
 
   inline void AddCandidate(SharedFunctionInfo* shared_info);
   inline void AddCandidate(JSFunction* function);
+  inline void AddBytecodeCandidate(SharedFunctionInfo* shared_info);
 
   void EvictCandidate(SharedFunctionInfo* shared_info);
   void EvictCandidate(JSFunction* function);
+  void EvictBytecodeCandidate(SharedFunctionInfo* shared_info);
 
   void ProcessCandidates() {
+    ProcessBytecodeCandidates();
     ProcessSharedFunctionInfoCandidates();
     ProcessJSFunctionCandidates();
   }
@@ -218,6 +222,8 @@ class CodeFlusher {
  private:
   void ProcessJSFunctionCandidates();
   void ProcessSharedFunctionInfoCandidates();
+  void ProcessBytecodeCandidates();
+  void FlushBytecodeIfUnmarked(SharedFunctionInfo* candidate);
 
   static inline JSFunction** GetNextCandidateSlot(JSFunction* candidate);
   static inline JSFunction* GetNextCandidate(JSFunction* candidate);
@@ -235,6 +241,11 @@ class CodeFlusher {
   Isolate* isolate_;
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
+  // Interpreted functions all share the same trampoline, so they cannot be
+  // linked through their code like the candidates above. They are kept in a
+  // list instead, which needs no updating by the scavenger since shared
+  // function infos are never allocated in new space.
+  List<SharedFunctionInfo*> bytecode_candidates_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
@@ -417,6 +417,10 @@ void StaticMarkingVisitor<StaticVisitor>::VisitCode(Map* map,
   if (FLAG_age_code && !heap->isolate()->serializer_enabled()) {
     code->MakeOlder();
   }
+  if (FLAG_flush_bytecode && code->kind() == Code::OPTIMIZED_FUNCTION &&
+      heap->mark_compact_collector()->is_code_flushing_enabled()) {
+    MarkBytecodeForDeoptimization(heap, code);
+  }
   CodeBodyVisitor::Visit(map, object);
 }
 
@@ -443,6 +447,14 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
       VisitSharedFunctionInfoWeakCode(map, object);
       return;
     }
+    if (IsFlushableBytecode(heap, shared)) {
+      // Same as above, optimized closures and optimized code inlining this
+      // function still mark the bytecode they deoptimize into.
+      collector->code_flusher()->AddBytecodeCandidate(shared);
+      // Treat the reference to the bytecode array weakly.
+      VisitSharedFunctionInfoWeakBytecode(map, object);
+      return;
+    }
   }
   VisitSharedFunctionInfoStrongCode(map, object);
 }
@@ -472,6 +484,13 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
     } else {
       // Visit all unoptimized code objects to prevent flushing them.
       StaticVisitor::MarkObject(heap, function->shared()->code());
+      // Closures that have not been called yet go through CompileLazy, which
+      // recompiles flushed bytecode. All others might still need it.
+      if (function->shared()->HasBytecodeArray() &&
+          function->code() !=
+              heap->isolate()->builtins()->builtin(Builtins::kCompileLazy)) {
+        StaticVisitor::MarkObject(heap, function->shared()->bytecode_array());
+      }
     }
   }
   VisitJSFunctionStrongCode(map, object);
@@ -524,6 +543,11 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(Heap* heap,
                                                       JSFunction* function) {
   SharedFunctionInfo* shared_info = function->shared();
 
+  // Interpreted closures share the trampoline, their code is the bytecode.
+  if (shared_info->IsInterpreted() && function->code() == shared_info->code()) {
+    return IsFlushableBytecode(heap, shared_info);
+  }
+
   // Code is either on stack, in compilation cache or referenced
   // by optimized version of function.
   MarkBit code_mark = ObjectMarking::MarkBitFrom(function->code());
@@ -555,6 +579,55 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
+  // Only flush code for functions.
+  if (shared_info->code()->kind() != Code::FUNCTION) {
+    return false;
+  }
+
+  // Maintain debug break slots in the code.
+  if (shared_info->HasDebugCode()) {
+    return false;
+  }
+
+  // Check age of code. If code aging is disabled we never flush.
+  if (!FLAG_age_code || !shared_info->code()->IsOld()) {
+    return false;
+  }
+
+  return IsRecompilable(heap, shared_info);
+}
+
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, SharedFunctionInfo* shared_info) {
+  if (!FLAG_flush_bytecode || !shared_info->IsInterpreted()) {
+    return false;
+  }
+
+  // Bytecode is either on stack, in compilation cache or referenced by
+  // optimized code that deoptimizes into it.
+  MarkBit bytecode_mark =
+      ObjectMarking::MarkBitFrom(shared_info->bytecode_array());
+  if (Marking::IsBlackOrGrey(bytecode_mark)) {
+    return false;
+  }
+
+  // The debugger holds on to the bytecode through the debug info.
+  if (shared_info->HasDebugInfo()) {
+    return false;
+  }
+
+  // Check age of bytecode, it is reset whenever the function is entered.
+  if (!shared_info->bytecode_array()->IsOld()) {
+    return false;
+  }
+
+  return IsRecompilable(heap, shared_info);
+}
+
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsRecompilable(
+    Heap* heap, SharedFunctionInfo* shared_info) {
   // The function must be compiled and have the source code available,
   // to be able to recompile it in case we need the function again.
   if (!(shared_info->is_compiled() && HasSourceCode(heap, shared_info))) {
@@ -566,11 +639,6 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
-  // Only flush code for functions.
-  if (shared_info->code()->kind() != Code::FUNCTION) {
-    return false;
-  }
-
   // Function must be lazy compilable.
   if (!shared_info->allows_lazy_compilation()) {
     return false;
@@ -593,25 +661,39 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
     return false;
   }
 
-  // Maintain debug break slots in the code.
-  if (shared_info->HasDebugCode()) {
-    return false;
-  }
-
   // If this is a function initialized with %SetCode then the one-to-one
   // relation between SharedFunctionInfo and Code is broken.
   if (shared_info->dont_flush()) {
     return false;
   }
 
-  // Check age of code. If code aging is disabled we never flush.
-  if (!FLAG_age_code || !shared_info->code()->IsOld()) {
-    return false;
-  }
-
   return true;
 }
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::MarkBytecodeForDeoptimization(
+    Heap* heap, Code* code) {
+  // Optimized code deoptimizes into the bytecode of the outermost function
+  // and of all the functions it inlined.
+  FixedArray* raw_data = code->deoptimization_data();
+  if (raw_data->length() == 0) return;
+  DeoptimizationInputData* data = DeoptimizationInputData::cast(raw_data);
+  Object* outer = data->SharedFunctionInfo();
+  if (outer->IsSharedFunctionInfo() &&
+      SharedFunctionInfo::cast(outer)->HasBytecodeArray()) {
+    StaticVisitor::MarkObject(
+        heap, SharedFunctionInfo::cast(outer)->bytecode_array());
+  }
+  FixedArray* literals = data->LiteralArray();
+  int const inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = 0; i < inlined_count; ++i) {
+    SharedFunctionInfo* inlined = SharedFunctionInfo::cast(literals->get(i));
+    if (inlined->HasBytecodeArray()) {
+      StaticVisitor::MarkObject(heap, inlined->bytecode_array());
+    }
+  }
+}
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Map* map, HeapObject* object) {
@@ -629,6 +711,23 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakCode(
                    void>::Visit(map, object);
 }
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakBytecode(
+    Map* map, HeapObject* object) {
+  // Skip visiting kFunctionDataOffset as it is treated weakly here.
+  Heap* heap = map->GetHeap();
+  StaticVisitor::VisitPointers(
+      heap, object,
+      HeapObject::RawField(object, SharedFunctionInfo::kCodeOffset),
+      HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset));
+  StaticVisitor::VisitPointers(
+      heap, object,
+      HeapObject::RawField(object, SharedFunctionInfo::kScriptOffset),
+      HeapObject::RawField(object,
+                           SharedFunctionInfo::kLastPointerFieldOffset +
+                               kPointerSize));
+}
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitJSFunctionStrongCode(
     Map* map, HeapObject* object) {
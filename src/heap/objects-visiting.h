@@ -388,11 +388,18 @@ class StaticMarkingVisitor : public StaticVisitorBase {
   // Code flushing support.
   INLINE(static bool IsFlushable(Heap* heap, JSFunction* function));
   INLINE(static bool IsFlushable(Heap* heap, SharedFunctionInfo* shared_info));
+  INLINE(static bool IsFlushableBytecode(Heap* heap,
+                                         SharedFunctionInfo* shared_info));
+  INLINE(static bool IsRecompilable(Heap* heap,
+                                    SharedFunctionInfo* shared_info));
+  static void MarkBytecodeForDeoptimization(Heap* heap, Code* code);
 
   // Helpers used by code flushing support that visit pointer fields and treat
   // references to code objects either strongly or weakly.
   static void VisitSharedFunctionInfoStrongCode(Map* map, HeapObject* object);
   static void VisitSharedFunctionInfoWeakCode(Map* map, HeapObject* object);
+  static void VisitSharedFunctionInfoWeakBytecode(Map* map,
+                                                  HeapObject* object);
   static void VisitJSFunctionStrongCode(Map* map, HeapObject* object);
   static void VisitJSFunctionWeakCode(Map* map, HeapObject* object);
 
@@ -50,11 +50,13 @@ class AccessorAssemblerImpl : public CodeStubAssembler {
                          Label* if_handler, Variable* var_handler,
                          Label* if_miss);
 
-  Node* StubCachePrimaryOffsetForTesting(Node* name, Node* map) {
-    return StubCachePrimaryOffset(name, map);
+  Node* StubCachePrimaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                         Node* map) {
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  Node* StubCacheSecondaryOffsetForTesting(Node* name, Node* map) {
-    return StubCacheSecondaryOffset(name, map);
+  Node* StubCacheSecondaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                           Node* map) {
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
  protected:
@@ -177,8 +179,10 @@ class AccessorAssemblerImpl : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  Node* StubCachePrimaryOffset(Node* name, Node* map);
-  Node* StubCacheSecondaryOffset(Node* name, Node* seed);
+  Node* StubCacheTableMask(StubCache* stub_cache, StubCacheTable table_id);
+  Node* StubCachePrimaryOffset(StubCache* stub_cache, Node* name, Node* map);
+  Node* StubCacheSecondaryOffset(StubCache* stub_cache, Node* name,
+                                 Node* seed);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               Node* entry_offset, Node* name, Node* map,
@@ -226,10 +226,47 @@ void AccessorAssemblerImpl::HandleLoadICSmiHandlerCase(
     Comment("property_load");
   }
 
-  Label constant(this), field(this);
+  Label constant(this), field(this), normal(this);
+  GotoIf(WordEqual(handler_kind, IntPtrConstant(LoadHandler::kForNormal)),
+         &normal);
   Branch(WordEqual(handler_kind, IntPtrConstant(LoadHandler::kForFields)),
          &field, &constant);
 
+  Bind(&normal);
+  {
+    Comment("load_normal");
+    Node* properties = LoadProperties(holder);
+    Variable var_name_index(this, MachineType::PointerRepresentation());
+    Label found(this, &var_name_index), probe(this);
+
+    // Try the entry the property was found at when the handler was created
+    // first. Keys are unique names, so a matching key is the right entry.
+    Node* entry =
+        DecodeWord<LoadHandler::NameDictionaryEntryBits>(handler_word);
+    Node* name_index = EntryToIndex<NameDictionary>(entry);
+    var_name_index.Bind(name_index);
+    GotoUnless(UintPtrLessThan(name_index,
+                               LoadAndUntagFixedArrayBaseLength(properties)),
+               &probe);
+    Branch(WordEqual(LoadFixedArrayElement(properties, name_index), p->name),
+           &found, &probe);
+
+    Bind(&probe);
+    IncrementCounter(isolate()->counters()->ic_load_normal_probe(), 1);
+    NameDictionaryLookup<NameDictionary>(properties, p->name, &found,
+                                         &var_name_index, miss);
+
+    Bind(&found);
+    {
+      Variable var_details(this, MachineRepresentation::kWord32);
+      Variable var_value(this, MachineRepresentation::kTagged);
+      LoadPropertyFromNameDictionary(properties, var_name_index.value(),
+                                     &var_details, &var_value);
+      Return(CallGetterIfAccessor(var_value.value(), var_details.value(),
+                                  p->context, p->receiver, miss));
+    }
+  }
+
   Bind(&field);
   {
     Comment("field_load");
@@ -1010,7 +1047,16 @@ enum AccessorAssemblerImpl::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-Node* AccessorAssemblerImpl::StubCachePrimaryOffset(Node* name, Node* map) {
+Node* AccessorAssemblerImpl::StubCacheTableMask(StubCache* stub_cache,
+                                                StubCacheTable table_id) {
+  StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  return Load(MachineType::Uint32(),
+              ExternalConstant(
+                  ExternalReference(stub_cache->mask_reference(table))));
+}
+
+Node* AccessorAssemblerImpl::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                    Node* name, Node* map) {
   // See v8::internal::StubCache::PrimaryOffset().
   STATIC_ASSERT(StubCache::kCacheIndexShift == Name::kHashShift);
   // Compute the hash of the name (use entire hash field).
@@ -1027,21 +1073,20 @@ Node* AccessorAssemblerImpl::StubCachePrimaryOffset(Node* name, Node* map) {
   Node* hash = Int32Add(hash_field, map32);
   // Base the offset on a simple combination of name and map.
   hash = Word32Xor(hash, Int32Constant(StubCache::kPrimaryMagic));
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = StubCacheTableMask(stub_cache, kPrimary);
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
-Node* AccessorAssemblerImpl::StubCacheSecondaryOffset(Node* name, Node* seed) {
+Node* AccessorAssemblerImpl::StubCacheSecondaryOffset(StubCache* stub_cache,
+                                                      Node* name, Node* seed) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
   Node* name32 = TruncateWordToWord32(BitcastTaggedToWord(name));
   Node* hash = Int32Sub(TruncateWordToWord32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = StubCacheTableMask(stub_cache, kSecondary);
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
 void AccessorAssemblerImpl::TryProbeStubCacheTable(
@@ -1063,22 +1108,23 @@ void AccessorAssemblerImpl::TryProbeStubCacheTable(
   const int kMultiplier = sizeof(StubCache::Entry) >> Name::kHashShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  // Check that the key in the entry matches the name.
-  Node* key_base =
-      ExternalConstant(ExternalReference(stub_cache->key_reference(table)));
+  // Check that the key in the entry matches the name. The table can move
+  // when the cache is resized, so load its current address.
+  STATIC_ASSERT(offsetof(StubCache::Entry, key) == 0);
+  Node* key_base = Load(
+      MachineType::Pointer(),
+      ExternalConstant(ExternalReference(stub_cache->table_reference(table))));
   Node* entry_key = Load(MachineType::Pointer(), key_base, entry_offset);
   GotoIf(WordNotEqual(name, entry_key), if_miss);
 
   // Get the map entry from the cache.
-  DCHECK_EQ(kPointerSize * 2, stub_cache->map_reference(table).address() -
-                                  stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, map) == kPointerSize * 2);
   Node* entry_map =
       Load(MachineType::Pointer(), key_base,
            IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize * 2)));
   GotoIf(WordNotEqual(map, entry_map), if_miss);
 
-  DCHECK_EQ(kPointerSize, stub_cache->value_reference(table).address() -
-                              stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, value) == kPointerSize);
   Node* handler = Load(MachineType::TaggedPointer(), key_base,
                        IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize)));
 
@@ -1103,14 +1149,15 @@ void AccessorAssemblerImpl::TryProbeStubCache(StubCache* stub_cache,
   Node* receiver_map = LoadMap(receiver);
 
   // Probe the primary table.
-  Node* primary_offset = StubCachePrimaryOffset(name, receiver_map);
+  Node* primary_offset = StubCachePrimaryOffset(stub_cache, name, receiver_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          receiver_map, if_handler, var_handler, &try_secondary);
 
   Bind(&try_secondary);
   {
     // Probe the secondary table.
-    Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
+    Node* secondary_offset =
+        StubCacheSecondaryOffset(stub_cache, name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            receiver_map, if_handler, var_handler, &miss);
   }
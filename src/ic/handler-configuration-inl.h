@@ -22,6 +22,14 @@ Handle<Object> LoadHandler::LoadField(Isolate* isolate,
   return handle(Smi::FromInt(config), isolate);
 }
 
+Handle<Object> LoadHandler::LoadNormal(Isolate* isolate, int entry) {
+  // Out of range entries are not worth caching, fall back to the full probe.
+  unsigned hint = NameDictionaryEntryBits::is_valid(entry) ? entry : 0;
+  int config = KindBits::encode(kForNormal) |
+               NameDictionaryEntryBits::encode(hint);
+  return handle(Smi::FromInt(config), isolate);
+}
+
 Handle<Object> LoadHandler::LoadConstant(Isolate* isolate, int descriptor) {
   int config = KindBits::encode(kForConstants) |
                IsAccessorInfoBits::encode(false) |
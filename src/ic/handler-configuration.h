@@ -16,8 +16,14 @@ namespace internal {
 // A set of bit fields representing Smi handlers for loads.
 class LoadHandler {
  public:
-  enum Kind { kForElements, kForFields, kForConstants, kForNonExistent };
-  class KindBits : public BitField<Kind, 0, 2> {};
+  enum Kind {
+    kForElements,
+    kForFields,
+    kForConstants,
+    kForNonExistent,
+    kForNormal
+  };
+  class KindBits : public BitField<Kind, 0, 3> {};
 
   // Defines whether access rights check should be done on receiver object.
   // Applicable to kForFields, kForConstants and kForNonExistent kinds only when
@@ -58,6 +64,18 @@ class LoadHandler {
   // Make sure we don't overflow the smi.
   STATIC_ASSERT(FieldOffsetBits::kNext <= kSmiValueSize);
 
+  //
+  // Encoding when KindBits contains kForNormal.
+  //
+  // Entry of the property in the holder's NameDictionary at the time the
+  // handler was created. It is only a hint, the key at the entry is checked
+  // before use and a full dictionary probe is done if it does not match.
+  class NameDictionaryEntryBits
+      : public BitField<unsigned, DoNegativeLookupOnReceiverBits::kNext, 24> {
+  };
+  // Make sure we don't overflow the smi.
+  STATIC_ASSERT(NameDictionaryEntryBits::kNext <= kSmiValueSize);
+
   //
   // Encoding when KindBits contains kForElements.
   //
@@ -87,6 +105,10 @@ class LoadHandler {
   static inline Handle<Object> LoadField(Isolate* isolate,
                                          FieldIndex field_index);
 
+  // Creates a Smi-handler for loading a property from a slow object, with
+  // {entry} as a hint where to find it in the property dictionary.
+  static inline Handle<Object> LoadNormal(Isolate* isolate, int entry);
+
   // Creates a Smi-handler for loading a constant from fast object.
   static inline Handle<Object> LoadConstant(Isolate* isolate, int descriptor);
 
@@ -96,7 +96,9 @@ ICInfo::ICInfo()
       is_optimized(false),
       map(nullptr),
       is_dictionary_map(0),
-      number_of_own_descriptors(0) {}
+      number_of_own_descriptors(0),
+      stub_cache_size(0),
+      stub_cache_misses(0) {}
 
 void ICInfo::Reset() {
   type.clear();
@@ -111,6 +113,8 @@ void ICInfo::Reset() {
   is_dictionary_map = false;
   number_of_own_descriptors = 0;
   instance_type.clear();
+  stub_cache_size = 0;
+  stub_cache_misses = 0;
 }
 
 void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
@@ -137,6 +141,10 @@ void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
   if (map) value->SetInteger("dict", is_dictionary_map);
   if (map) value->SetInteger("own", number_of_own_descriptors);
   if (!instance_type.empty()) value->SetString("instanceType", instance_type);
+  if (stub_cache_size) {
+    value->SetInteger("stubCacheSize", stub_cache_size);
+    value->SetInteger("stubCacheMisses", stub_cache_misses);
+  }
   value->EndDictionary();
 }
 
@@ -43,6 +43,10 @@ struct ICInfo {
   // Number of own descriptors.
   unsigned number_of_own_descriptors;
   std::string instance_type;
+  // For megamorphic ICs, size of the stub cache they use and the number of
+  // misses it had since the last GC.
+  int stub_cache_size;
+  int stub_cache_misses;
 };
 
 class ICStats {
@@ -164,6 +164,12 @@ void IC::TraceIC(const char* type, Handle<Object> name, State old_state,
     ic_info.state += modifier;
     ic_info.state += ")";
     ic_info.map = reinterpret_cast<void*>(map);
+    if (new_state == MEGAMORPHIC &&
+        (kind() == Code::LOAD_IC || kind() == Code::KEYED_LOAD_IC ||
+         kind() == Code::STORE_IC || kind() == Code::KEYED_STORE_IC)) {
+      ic_info.stub_cache_size = stub_cache()->primary_table_size();
+      ic_info.stub_cache_misses = stub_cache()->misses();
+    }
   } else {
     PrintF(" (%c->%c%s) map=(%p", TransitionMarkFromState(old_state),
            TransitionMarkFromState(new_state), modifier,
@@ -1397,23 +1403,28 @@ Handle<Object> LoadIC::GetMapIndependentHandler(LookupIterator* lookup) {
 
     case LookupIterator::DATA: {
       if (lookup->is_dictionary_holder()) {
-        if (kind() != Code::LOAD_IC && kind() != Code::LOAD_GLOBAL_IC) {
-          TRACE_HANDLER_STATS(isolate(), LoadIC_SlowStub);
-          return slow_stub();
-        }
         if (holder->IsJSGlobalObject()) {
+          if (kind() == Code::KEYED_LOAD_IC) {
+            TRACE_HANDLER_STATS(isolate(), LoadIC_SlowStub);
+            return slow_stub();
+          }
           break;  // Custom-compiled handler.
         }
-        // There is only one shared stub for loading normalized
-        // properties. It does not traverse the prototype chain, so the
-        // property must be found in the object for the stub to be
-        // applicable.
+        // Loads of normalized properties do not traverse the prototype
+        // chain, so the property must be found in the object for the
+        // handler to be applicable.
         if (!receiver_is_holder) {
           TRACE_HANDLER_STATS(isolate(), LoadIC_SlowStub);
           return slow_stub();
         }
-        TRACE_HANDLER_STATS(isolate(), LoadIC_LoadNormal);
-        return isolate()->builtins()->LoadIC_Normal();
+        if (kind() == Code::LOAD_GLOBAL_IC) {
+          TRACE_HANDLER_STATS(isolate(), LoadIC_LoadNormal);
+          return isolate()->builtins()->LoadIC_Normal();
+        }
+        // The Smi handler caches the dictionary entry of the property, which
+        // saves the probe as long as the entry does not move.
+        TRACE_HANDLER_STATS(isolate(), LoadIC_LoadNormalDH);
+        return LoadHandler::LoadNormal(isolate(), lookup->GetDictionaryEntry());
       }
 
       // -------------- Fields --------------
@@ -13,18 +13,49 @@ namespace v8 {
 namespace internal {
 
 StubCache::StubCache(Isolate* isolate, Code::Kind ic_kind)
-    : isolate_(isolate), ic_kind_(ic_kind) {
+    : primary_(nullptr),
+      secondary_(nullptr),
+      primary_mask_(0),
+      secondary_mask_(0),
+      primary_table_bits_(0),
+      misses_(0),
+      isolate_(isolate),
+      ic_kind_(ic_kind) {
   // Ensure the nullptr (aka Smi::kZero) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(nullptr));
 }
 
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+}
+
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo32(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo32(kSecondaryTableSize));
+  int primary_table_bits = kDefaultPrimaryTableBits;
+  int requested_size = isolate_->stub_cache_size();
+  if (requested_size > 0) {
+    uint32_t size = base::bits::RoundUpToPowerOfTwo32(requested_size);
+    primary_table_bits = WhichPowerOf2(size);
+    primary_table_bits = Max(primary_table_bits, kMinPrimaryTableBits);
+    primary_table_bits = Min(primary_table_bits, kMaxPrimaryTableBits);
+  }
+  AllocateTables(primary_table_bits);
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_table_bits) {
+  DCHECK_LE(kMinPrimaryTableBits, primary_table_bits);
+  DCHECK_GE(kMaxPrimaryTableBits, primary_table_bits);
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+  primary_table_bits_ = primary_table_bits;
+  primary_ = NewArray<Entry>(primary_table_size());
+  secondary_ = NewArray<Entry>(secondary_table_size());
+  primary_mask_ = (primary_table_size() - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size() - 1) << kCacheIndexShift;
+}
+
 #ifdef DEBUG
 namespace {
 
@@ -75,6 +106,7 @@ Object* StubCache::Set(Name* name, Map* map, Object* handler) {
   primary->key = name;
   primary->value = handler;
   primary->map = map;
+  misses_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
   return handler;
 }
@@ -96,13 +128,23 @@ Object* StubCache::Get(Name* name, Map* map) {
 
 
 void StubCache::Clear() {
+  if (FLAG_adaptive_stub_cache && primary_table_bits_ < kMaxPrimaryTableBits &&
+      misses_ > primary_table_size()) {
+    AllocateTables(primary_table_bits_ + 1);
+    if (FLAG_trace_stub_cache) {
+      PrintF("[growing %s stub cache to %d entries after %d misses]\n",
+             Code::Kind2String(ic_kind_), primary_table_size(), misses_);
+    }
+  }
+  misses_ = 0;
+
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = isolate()->heap()->empty_string();
     primary_[i].map = NULL;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = isolate()->heap()->empty_string();
     secondary_[j].map = NULL;
     secondary_[j].value = empty;
@@ -113,7 +155,7 @@ void StubCache::Clear() {
 void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                                     Handle<Context> native_context,
                                     Zone* zone) {
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     if (primary_[i].key == *name) {
       Map* map = primary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -128,7 +170,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
     }
   }
 
-  for (int i = 0; i < kSecondaryTableSize; i++) {
+  for (int i = 0; i < secondary_table_size(); i++) {
     if (secondary_[i].key == *name) {
       Map* map = secondary_[i].map;
       // Map can be NULL, if the stub is constant function call
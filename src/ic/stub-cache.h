@@ -39,11 +39,14 @@ class StubCache {
     Map* map;
   };
 
+  // Allocates the tables with the size requested for the isolate.
   void Initialize();
   // Access cache for entry hash(name, map).
   Object* Set(Name* name, Map* map, Object* handler);
   Object* Get(Name* name, Map* map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). With adaptive sizing,
+  // tables that were refilled more often than they have entries since the
+  // last clear are grown first.
   void Clear();
   // Collect all maps that match the name.
   void CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
@@ -51,19 +54,16 @@ class StubCache {
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
+  // The tables move when the cache is resized, so generated code loads the
+  // address of the first entry and the index mask through these references.
+  SCTableReference table_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_ : &secondary_));
   }
 
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
-  }
-
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -80,30 +80,41 @@ class StubCache {
   Isolate* isolate() { return isolate_; }
   Code::Kind ic_kind() const { return ic_kind_; }
 
+  int primary_table_size() const { return 1 << primary_table_bits_; }
+  int secondary_table_size() const {
+    return 1 << (primary_table_bits_ - kSecondaryTableBitsDelta);
+  }
+
+  // Number of entries filled in since the last clear. Every fill follows a
+  // lookup that missed in generated code.
+  int misses() const { return misses_; }
+
   // Setting the entry size such that the index is shifted by Name::kHashShift
   // is convenient; shifting down the length field (to extract the hash code)
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kDefaultPrimaryTableBits = 11;
+  static const int kMinPrimaryTableBits = 8;
+  static const int kMaxPrimaryTableBits = 14;
+  // The secondary table has a quarter of the entries of the primary table.
+  static const int kSecondaryTableBitsDelta = 2;
 
   // Some magic number used in primary and secondary hash computations.
   static const int kPrimaryMagic = 0x3d532433;
   static const int kSecondaryMagic = 0xb16b00b5;
 
-  static int PrimaryOffsetForTesting(Name* name, Map* map) {
+  int PrimaryOffsetForTesting(Name* name, Map* map) {
     return PrimaryOffset(name, map);
   }
 
-  static int SecondaryOffsetForTesting(Name* name, int seed) {
+  int SecondaryOffsetForTesting(Name* name, int seed) {
     return SecondaryOffset(name, seed);
   }
 
   // The constructor is made public only for the purposes of testing.
   StubCache(Isolate* isolate, Code::Kind ic_kind);
+  ~StubCache();
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -116,7 +127,7 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name* name, Map* map) {
+  int PrimaryOffset(Name* name, Map* map) {
     STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
     // Compute the hash of the name (use entire hash field).
     DCHECK(name->HasHashCode());
@@ -128,18 +139,18 @@ class StubCache {
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(map));
     // Base the offset on a simple combination of name and map.
     uint32_t key = (map_low32bits + field) ^ kPrimaryMagic;
-    return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+    return key & primary_mask_;
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name* name, int seed) {
+  int SecondaryOffset(Name* name, int seed) {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
     uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-    return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+    return key & secondary_mask_;
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -154,8 +165,16 @@ class StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // (Re)allocates both tables, their contents are undefined until cleared.
+  void AllocateTables(int primary_table_bits);
+
+  Entry* primary_;
+  Entry* secondary_;
+  // Masks applied to the hashes, already scaled by 1 << kCacheIndexShift.
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
+  int primary_table_bits_;
+  int misses_;
   Isolate* isolate_;
   Code::Kind ic_kind_;
 
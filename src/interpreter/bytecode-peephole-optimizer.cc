@@ -141,6 +141,20 @@ BytecodeNode TransformLdaZeroBinaryOpToBinaryOpWithZero(
   return node;
 }
 
+BytecodeNode TransformLdarBinaryOpToBinaryOpWithRegisters(
+    Bytecode new_bytecode, BytecodeNode* const last,
+    BytecodeNode* const current) {
+  DCHECK_EQ(last->bytecode(), Bytecode::kLdar);
+  // The register of the Ldar is the right-hand side, since binary operations
+  // compute <register> op <accumulator>.
+  BytecodeNode node(new_bytecode, current->operand(0), last->operand(0),
+                    current->operand(1), current->source_info());
+  if (last->source_info().is_valid()) {
+    node.set_source_info(last->source_info());
+  }
+  return node;
+}
+
 BytecodeNode TransformEqualityWithNullOrUndefined(Bytecode new_bytecode,
                                                   BytecodeNode* const last,
                                                   BytecodeNode* const current) {
@@ -268,6 +282,22 @@ void BytecodePeepholeOptimizer::
   }
 }
 
+void BytecodePeepholeOptimizer::
+    TransformLdarBinaryOpToBinaryOpWithRegistersAction(
+        BytecodeNode* const node, const PeepholeActionAndData* action_data) {
+  DCHECK(LastIsValid());
+  DCHECK(!Bytecodes::IsJump(node->bytecode()));
+  if (FLAG_ignition_superinstructions &&
+      (!node->source_info().is_valid() || !last()->source_info().is_valid())) {
+    // Fused last and current into current.
+    BytecodeNode new_node(TransformLdarBinaryOpToBinaryOpWithRegisters(
+        action_data->bytecode, last(), node));
+    SetLast(&new_node);
+  } else {
+    DefaultAction(node);
+  }
+}
+
 void BytecodePeepholeOptimizer::TransformEqualityWithNullOrUndefinedAction(
     BytecodeNode* const node, const PeepholeActionAndData* action_data) {
   DCHECK(LastIsValid());
@@ -222,6 +222,7 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kMul:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kAddRegisters:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
@@ -134,6 +134,10 @@ namespace interpreter {
   V(ShiftRightSmi, AccumulatorUse::kWrite, OperandType::kImm,                  \
     OperandType::kReg, OperandType::kIdx)                                      \
                                                                                \
+  /* Binary operators with register operands */                               \
+  V(AddRegisters, AccumulatorUse::kWrite, OperandType::kReg,                   \
+    OperandType::kReg, OperandType::kIdx)                                      \
+                                                                               \
   /* Unary Operators */                                                        \
   V(Inc, AccumulatorUse::kReadWrite, OperandType::kIdx)                        \
   V(Dec, AccumulatorUse::kReadWrite, OperandType::kIdx)                        \
@@ -1549,6 +1549,22 @@ void Interpreter::DoShiftRightSmi(InterpreterAssembler* assembler) {
   __ Dispatch();
 }
 
+// AddRegisters <lhs> <rhs> <slot>
+//
+// Adds register <rhs> to register <lhs>. Emitted by the peephole optimizer in
+// place of Ldar <rhs> followed by Add <lhs>.
+void Interpreter::DoAddRegisters(InterpreterAssembler* assembler) {
+  Node* lhs = __ LoadRegister(__ BytecodeOperandReg(0));
+  Node* rhs = __ LoadRegister(__ BytecodeOperandReg(1));
+  Node* context = __ GetContext();
+  Node* slot_index = __ BytecodeOperandIdx(2);
+  Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+  Node* result = AddWithFeedbackStub::Generate(
+      assembler, lhs, rhs, slot_index, type_feedback_vector, context);
+  __ SetAccumulator(result);
+  __ Dispatch();
+}
+
 Node* Interpreter::BuildUnaryOp(Callable callable,
                                 InterpreterAssembler* assembler) {
   Node* target = __ HeapConstant(callable.code());
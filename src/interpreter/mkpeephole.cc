@@ -192,6 +192,15 @@ PeepholeActionAndData PeepholeActionTableWriter::LookupActionAndData(
     }
   }
 
+  // Fuse Ldar followed by Add into an addition of two registers. Together
+  // with the Star lookahead of its handler, the common Ldar, Add, Star
+  // sequence then executes with a single dispatch.
+  if (last == Bytecode::kLdar && current == Bytecode::kAdd) {
+    return {
+        PeepholeAction::kTransformLdarBinaryOpToBinaryOpWithRegistersAction,
+        Bytecode::kAddRegisters};
+  }
+
   // Fuse LdaNull/LdaUndefined followed by a equality comparison with test
   // undetectable. Testing undetectable is a simple check on the map which is
   // more efficient than the full comparison operation.
@@ -24,6 +24,7 @@
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/crankshaft/hydrogen.h"
 #include "src/debug/debug.h"
+#include "src/deoptimization-log.h"
 #include "src/deoptimizer.h"
 #include "src/elements.h"
 #include "src/external-reference-table.h"
@@ -2185,6 +2186,7 @@ Isolate::Isolate(bool enable_serializer)
       deoptimizer_data_(NULL),
       deoptimizer_lazy_throw_(false),
       materialized_object_store_(NULL),
+      deoptimization_log_(NULL),
       capture_stack_trace_for_uncaught_exceptions_(false),
       stack_trace_for_uncaught_exceptions_frame_limit_(0),
       stack_trace_for_uncaught_exceptions_options_(StackTrace::kOverview),
@@ -2429,6 +2431,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = NULL;
 
+  delete deoptimization_log_;
+  deoptimization_log_ = NULL;
+
   delete logger_;
   logger_ = NULL;
 
@@ -2568,6 +2573,7 @@ bool Isolate::Init(Deserializer* des) {
   load_stub_cache_ = new StubCache(this, Code::LOAD_IC);
   store_stub_cache_ = new StubCache(this, Code::STORE_IC);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deoptimization_log_ = new DeoptimizationLog(Max(FLAG_deopt_log_size, 0));
   regexp_stack_ = new RegExpStack();
   regexp_stack_->isolate_ = this;
   date_cache_ = new DateCache();
@@ -52,6 +52,7 @@ class ContextSlotCache;
 class Counters;
 class CpuFeatures;
 class CpuProfiler;
+class DeoptimizationLog;
 class DeoptimizerData;
 class DescriptorLookupCache;
 class Deserializer;
@@ -418,6 +419,8 @@ typedef List<HeapObject*> DebugObjectCache;
   V(const v8::StartupData*, snapshot_blob, nullptr)                           \
   V(int, code_and_metadata_size, 0)                                           \
   V(int, bytecode_and_metadata_size, 0)                                       \
+  /* Initial number of entries of the primary stub cache tables, or 0. */     \
+  V(int, stub_cache_size, 0)                                                  \
   /* true if being profiled. Causes collection of extra compile info. */      \
   V(bool, is_profiling, false)                                                \
   /* true if a trace is being formatted through Error.prepareStackTrace. */   \
@@ -865,6 +868,7 @@ class Isolate {
   MaterializedObjectStore* materialized_object_store() {
     return materialized_object_store_;
   }
+  DeoptimizationLog* deoptimization_log() { return deoptimization_log_; }
 
   ContextSlotCache* context_slot_cache() {
     return context_slot_cache_;
@@ -1339,6 +1343,7 @@ class Isolate {
   DeoptimizerData* deoptimizer_data_;
   bool deoptimizer_lazy_throw_;
   MaterializedObjectStore* materialized_object_store_;
+  DeoptimizationLog* deoptimization_log_;
   ThreadLocalTop thread_local_top_;
   bool capture_stack_trace_for_uncaught_exceptions_;
   int stack_trace_for_uncaught_exceptions_frame_limit_;
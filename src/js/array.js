@@ -999,6 +999,12 @@ function ArraySort(comparefn) {
 
   var array = TO_OBJECT(this);
   var length = TO_LENGTH(array.length);
+  // Arrays of only Smis or only strings are sorted natively with the default
+  // comparator.
+  if (!IS_CALLABLE(comparefn) && IS_ARRAY(array) && length <= kMaxUint32 &&
+      %ArraySortFast(array, length)) {
+    return array;
+  }
   return InnerArraySort(array, length, comparefn);
 }
 
@@ -1056,17 +1062,6 @@ function InnerArrayForEach(f, receiver, array, length) {
 }
 
 
-function ArrayForEach(f, receiver) {
-  CHECK_OBJECT_COERCIBLE(this, "Array.prototype.forEach");
-
-  // Pull out the length so that modifications to the length in the
-  // loop will not affect the looping and side effects are visible.
-  var array = TO_OBJECT(this);
-  var length = TO_LENGTH(array.length);
-  InnerArrayForEach(f, receiver, array, length);
-}
-
-
 function InnerArraySome(f, receiver, array, length) {
   if (!IS_CALLABLE(f)) throw %make_type_error(kCalledNonCallable, f);
 
@@ -1080,19 +1075,6 @@ function InnerArraySome(f, receiver, array, length) {
 }
 
 
-// Executes the function once for each element present in the
-// array until it finds one where callback returns true.
-function ArraySome(f, receiver) {
-  CHECK_OBJECT_COERCIBLE(this, "Array.prototype.some");
-
-  // Pull out the length so that modifications to the length in the
-  // loop will not affect the looping and side effects are visible.
-  var array = TO_OBJECT(this);
-  var length = TO_LENGTH(array.length);
-  return InnerArraySome(f, receiver, array, length);
-}
-
-
 function InnerArrayEvery(f, receiver, array, length) {
   if (!IS_CALLABLE(f)) throw %make_type_error(kCalledNonCallable, f);
 
@@ -1105,17 +1087,6 @@ function InnerArrayEvery(f, receiver, array, length) {
   return true;
 }
 
-function ArrayEvery(f, receiver) {
-  CHECK_OBJECT_COERCIBLE(this, "Array.prototype.every");
-
-  // Pull out the length so that modifications to the length in the
-  // loop will not affect the looping and side effects are visible.
-  var array = TO_OBJECT(this);
-  var length = TO_LENGTH(array.length);
-  return InnerArrayEvery(f, receiver, array, length);
-}
-
-
 function ArrayMap(f, receiver) {
   CHECK_OBJECT_COERCIBLE(this, "Array.prototype.map");
 
@@ -1558,9 +1529,9 @@ utils.InstallFunctions(GlobalArray.prototype, DONT_ENUM, [
   "splice", getFunction("splice", ArraySplice, 2),
   "sort", getFunction("sort", ArraySort),
   "filter", getFunction("filter", ArrayFilter, 1),
-  "forEach", getFunction("forEach", ArrayForEach, 1),
-  "some", getFunction("some", ArraySome, 1),
-  "every", getFunction("every", ArrayEvery, 1),
+  "forEach", getFunction("forEach", null, 1),
+  "some", getFunction("some", null, 1),
+  "every", getFunction("every", null, 1),
   "map", getFunction("map", ArrayMap, 1),
   "indexOf", getFunction("indexOf", null, 1),
   "lastIndexOf", getFunction("lastIndexOf", ArrayLastIndexOf, 1),
@@ -1622,9 +1593,7 @@ utils.Export(function(to) {
   to.ArrayPush = ArrayPush;
   to.ArrayToString = ArrayToString;
   to.ArrayValues = ArrayValues;
-  to.InnerArrayCopyWithin = InnerArrayCopyWithin;
   to.InnerArrayEvery = InnerArrayEvery;
-  to.InnerArrayFill = InnerArrayFill;
   to.InnerArrayFilter = InnerArrayFilter;
   to.InnerArrayFind = InnerArrayFind;
   to.InnerArrayFindIndex = InnerArrayFindIndex;
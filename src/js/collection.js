@@ -27,27 +27,26 @@ utils.Import(function(from) {
 
 // -------------------------------------------------------------------
 
-function HashToEntry(table, hash, numBuckets) {
+function HashToLink(table, hash, numBuckets) {
   var bucket = ORDERED_HASH_TABLE_HASH_TO_BUCKET(hash, numBuckets);
   return ORDERED_HASH_TABLE_BUCKET_AT(table, bucket);
 }
-%SetForceInlineFlag(HashToEntry);
+%SetForceInlineFlag(HashToLink);
 
 
+// Only the keys of entries whose links match the hash are compared, see
+// OrderedHashTable::FindEntry.
 function SetFindEntry(table, numBuckets, key, hash) {
-  var entry = HashToEntry(table, hash, numBuckets);
-  if (entry === NOT_FOUND) return entry;
-  var candidate = ORDERED_HASH_SET_KEY_AT(table, entry, numBuckets);
-  if (key === candidate) return entry;
+  var link = HashToLink(table, hash, numBuckets);
   var keyIsNaN = NUMBER_IS_NAN(key);
-  while (true) {
-    if (keyIsNaN && NUMBER_IS_NAN(candidate)) {
-      return entry;
+  while (link !== NOT_FOUND) {
+    var entry = ORDERED_HASH_TABLE_LINK_TO_ENTRY(link);
+    if (ORDERED_HASH_TABLE_LINK_MATCHES_HASH(link, hash)) {
+      var candidate = ORDERED_HASH_SET_KEY_AT(table, entry, numBuckets);
+      if (key === candidate) return entry;
+      if (keyIsNaN && NUMBER_IS_NAN(candidate)) return entry;
     }
-    entry = ORDERED_HASH_SET_CHAIN_AT(table, entry, numBuckets);
-    if (entry === NOT_FOUND) return entry;
-    candidate = ORDERED_HASH_SET_KEY_AT(table, entry, numBuckets);
-    if (key === candidate) return entry;
+    link = ORDERED_HASH_SET_CHAIN_AT(table, entry, numBuckets);
   }
   return NOT_FOUND;
 }
@@ -55,19 +54,16 @@ function SetFindEntry(table, numBuckets, key, hash) {
 
 
 function MapFindEntry(table, numBuckets, key, hash) {
-  var entry = HashToEntry(table, hash, numBuckets);
-  if (entry === NOT_FOUND) return entry;
-  var candidate = ORDERED_HASH_MAP_KEY_AT(table, entry, numBuckets);
-  if (key === candidate) return entry;
+  var link = HashToLink(table, hash, numBuckets);
   var keyIsNaN = NUMBER_IS_NAN(key);
-  while (true) {
-    if (keyIsNaN && NUMBER_IS_NAN(candidate)) {
-      return entry;
+  while (link !== NOT_FOUND) {
+    var entry = ORDERED_HASH_TABLE_LINK_TO_ENTRY(link);
+    if (ORDERED_HASH_TABLE_LINK_MATCHES_HASH(link, hash)) {
+      var candidate = ORDERED_HASH_MAP_KEY_AT(table, entry, numBuckets);
+      if (key === candidate) return entry;
+      if (keyIsNaN && NUMBER_IS_NAN(candidate)) return entry;
     }
-    entry = ORDERED_HASH_MAP_CHAIN_AT(table, entry, numBuckets);
-    if (entry === NOT_FOUND) return entry;
-    candidate = ORDERED_HASH_MAP_KEY_AT(table, entry, numBuckets);
-    if (key === candidate) return entry;
+    link = ORDERED_HASH_MAP_CHAIN_AT(table, entry, numBuckets);
   }
   return NOT_FOUND;
 }
@@ -140,58 +136,6 @@ function SetConstructor(iterable) {
 }
 
 
-function SetAdd(key) {
-  if (!IS_SET(this)) {
-    throw %make_type_error(kIncompatibleMethodReceiver, 'Set.prototype.add', this);
-  }
-  // Normalize -0 to +0 as required by the spec.
-  // Even though we use SameValueZero as the comparison for the keys we don't
-  // want to ever store -0 as the key since the key is directly exposed when
-  // doing iteration.
-  if (key === 0) {
-    key = 0;
-  }
-  var table = %_JSCollectionGetTable(this);
-  var numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-  var hash = GetHash(key);
-  if (SetFindEntry(table, numBuckets, key, hash) !== NOT_FOUND) return this;
-
-  var nof = ORDERED_HASH_TABLE_ELEMENT_COUNT(table);
-  var nod = ORDERED_HASH_TABLE_DELETED_COUNT(table);
-  var capacity = numBuckets << 1;
-  if ((nof + nod) >= capacity) {
-    // Need to grow, bail out to runtime.
-    %SetGrow(this);
-    // Re-load state from the grown backing store.
-    table = %_JSCollectionGetTable(this);
-    numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-    nof = ORDERED_HASH_TABLE_ELEMENT_COUNT(table);
-    nod = ORDERED_HASH_TABLE_DELETED_COUNT(table);
-  }
-  var entry = nof + nod;
-  var index = ORDERED_HASH_SET_ENTRY_TO_INDEX(entry, numBuckets);
-  var bucket = ORDERED_HASH_TABLE_HASH_TO_BUCKET(hash, numBuckets);
-  var chainEntry = ORDERED_HASH_TABLE_BUCKET_AT(table, bucket);
-  ORDERED_HASH_TABLE_SET_BUCKET_AT(table, bucket, entry);
-  ORDERED_HASH_TABLE_SET_ELEMENT_COUNT(table, nof + 1);
-  FIXED_ARRAY_SET(table, index, key);
-  FIXED_ARRAY_SET_SMI(table, index + 1, chainEntry);
-  return this;
-}
-
-
-function SetHas(key) {
-  if (!IS_SET(this)) {
-    throw %make_type_error(kIncompatibleMethodReceiver, 'Set.prototype.has', this);
-  }
-  var table = %_JSCollectionGetTable(this);
-  var numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-  var hash = GetExistingHash(key);
-  if (IS_UNDEFINED(hash)) return false;
-  return SetFindEntry(table, numBuckets, key, hash) !== NOT_FOUND;
-}
-
-
 function SetDelete(key) {
   if (!IS_SET(this)) {
     throw %make_type_error(kIncompatibleMethodReceiver,
@@ -270,11 +214,10 @@ function SetSpecies() {
 
 utils.InstallGetter(GlobalSet, speciesSymbol, SetSpecies);
 
-// Set up the non-enumerable functions on the Set prototype object.
+// Set up the non-enumerable functions on the Set prototype object. The add and
+// has methods are builtins installed by the bootstrapper.
 utils.InstallGetter(GlobalSet.prototype, "size", SetGetSize);
 utils.InstallFunctions(GlobalSet.prototype, DONT_ENUM, [
-  "add", SetAdd,
-  "has", SetHas,
   "delete", SetDelete,
   "clear", SetClearJS,
   "forEach", SetForEach
@@ -307,81 +250,6 @@ function MapConstructor(iterable) {
 }
 
 
-function MapGet(key) {
-  if (!IS_MAP(this)) {
-    throw %make_type_error(kIncompatibleMethodReceiver,
-                        'Map.prototype.get', this);
-  }
-  var table = %_JSCollectionGetTable(this);
-  var numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-  var hash = GetExistingHash(key);
-  if (IS_UNDEFINED(hash)) return UNDEFINED;
-  var entry = MapFindEntry(table, numBuckets, key, hash);
-  if (entry === NOT_FOUND) return UNDEFINED;
-  return ORDERED_HASH_MAP_VALUE_AT(table, entry, numBuckets);
-}
-
-
-function MapSet(key, value) {
-  if (!IS_MAP(this)) {
-    throw %make_type_error(kIncompatibleMethodReceiver,
-                        'Map.prototype.set', this);
-  }
-  // Normalize -0 to +0 as required by the spec.
-  // Even though we use SameValueZero as the comparison for the keys we don't
-  // want to ever store -0 as the key since the key is directly exposed when
-  // doing iteration.
-  if (key === 0) {
-    key = 0;
-  }
-
-  var table = %_JSCollectionGetTable(this);
-  var numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-  var hash = GetHash(key);
-  var entry = MapFindEntry(table, numBuckets, key, hash);
-  if (entry !== NOT_FOUND) {
-    var existingIndex = ORDERED_HASH_MAP_ENTRY_TO_INDEX(entry, numBuckets);
-    FIXED_ARRAY_SET(table, existingIndex + 1, value);
-    return this;
-  }
-
-  var nof = ORDERED_HASH_TABLE_ELEMENT_COUNT(table);
-  var nod = ORDERED_HASH_TABLE_DELETED_COUNT(table);
-  var capacity = numBuckets << 1;
-  if ((nof + nod) >= capacity) {
-    // Need to grow, bail out to runtime.
-    %MapGrow(this);
-    // Re-load state from the grown backing store.
-    table = %_JSCollectionGetTable(this);
-    numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-    nof = ORDERED_HASH_TABLE_ELEMENT_COUNT(table);
-    nod = ORDERED_HASH_TABLE_DELETED_COUNT(table);
-  }
-  entry = nof + nod;
-  var index = ORDERED_HASH_MAP_ENTRY_TO_INDEX(entry, numBuckets);
-  var bucket = ORDERED_HASH_TABLE_HASH_TO_BUCKET(hash, numBuckets);
-  var chainEntry = ORDERED_HASH_TABLE_BUCKET_AT(table, bucket);
-  ORDERED_HASH_TABLE_SET_BUCKET_AT(table, bucket, entry);
-  ORDERED_HASH_TABLE_SET_ELEMENT_COUNT(table, nof + 1);
-  FIXED_ARRAY_SET(table, index, key);
-  FIXED_ARRAY_SET(table, index + 1, value);
-  FIXED_ARRAY_SET(table, index + 2, chainEntry);
-  return this;
-}
-
-
-function MapHas(key) {
-  if (!IS_MAP(this)) {
-    throw %make_type_error(kIncompatibleMethodReceiver,
-                        'Map.prototype.has', this);
-  }
-  var table = %_JSCollectionGetTable(this);
-  var numBuckets = ORDERED_HASH_TABLE_BUCKET_COUNT(table);
-  var hash = GetHash(key);
-  return MapFindEntry(table, numBuckets, key, hash) !== NOT_FOUND;
-}
-
-
 function MapDelete(key) {
   if (!IS_MAP(this)) {
     throw %make_type_error(kIncompatibleMethodReceiver,
@@ -457,12 +325,10 @@ function MapSpecies() {
 
 utils.InstallGetter(GlobalMap, speciesSymbol, MapSpecies);
 
-// Set up the non-enumerable functions on the Map prototype object.
+// Set up the non-enumerable functions on the Map prototype object. The get, has
+// and set methods are builtins installed by the bootstrapper.
 utils.InstallGetter(GlobalMap.prototype, "size", MapGetSize);
 utils.InstallFunctions(GlobalMap.prototype, DONT_ENUM, [
-  "get", MapGet,
-  "set", MapSet,
-  "has", MapHas,
   "delete", MapDelete,
   "clear", MapClearJS,
   "forEach", MapForEach
@@ -472,12 +338,7 @@ utils.InstallFunctions(GlobalMap.prototype, DONT_ENUM, [
 // Exports
 
 %InstallToContext([
-  "map_get", MapGet,
-  "map_set", MapSet,
-  "map_has", MapHas,
   "map_delete", MapDelete,
-  "set_add", SetAdd,
-  "set_has", SetHas,
   "set_delete", SetDelete,
 ]);
 
@@ -151,6 +151,11 @@ macro ORDERED_HASH_TABLE_SET_BUCKET_AT(table, bucket, entry) = (FIXED_ARRAY_SET(
 
 macro ORDERED_HASH_TABLE_HASH_TO_BUCKET(hash, numBuckets) = (hash & ((numBuckets) - 1));
 
+# Must match OrderedHashTable::MakeLink and friends.
+macro ORDERED_HASH_TABLE_MAKE_LINK(entry, hash) = (((hash) & 0x3e000000) | (entry));
+macro ORDERED_HASH_TABLE_LINK_TO_ENTRY(link) = ((link) & 0x1ffffff);
+macro ORDERED_HASH_TABLE_LINK_MATCHES_HASH(link, hash) = ((((link) ^ (hash)) & 0x3e000000) === 0);
+
 macro ORDERED_HASH_SET_ENTRY_TO_INDEX(entry, numBuckets) = (3 + (numBuckets) + ((entry) << 1));
 macro ORDERED_HASH_SET_KEY_AT(table, entry, numBuckets) = (FIXED_ARRAY_GET(table, ORDERED_HASH_SET_ENTRY_TO_INDEX(entry, numBuckets)));
 macro ORDERED_HASH_SET_CHAIN_AT(table, entry, numBuckets) = (FIXED_ARRAY_GET(table, ORDERED_HASH_SET_ENTRY_TO_INDEX(entry, numBuckets) + 1));
@@ -13,35 +13,137 @@ TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
     : max_chunks_(max_chunks) {
   trace_writer_.reset(trace_writer);
   chunks_.resize(max_chunks);
+  chunk_owner_.resize(max_chunks);
+  chunk_skipped_.resize(max_chunks);
+  thread_chunk_key_ = base::Thread::CreateThreadLocalKey();
 }
 
-TraceBufferRingBuffer::~TraceBufferRingBuffer() {}
+TraceBufferRingBuffer::~TraceBufferRingBuffer() {
+  base::Thread::DeleteThreadLocalKey(thread_chunk_key_);
+}
 
 TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
+  ThreadChunk* thread_chunk = GetThreadChunk();
+  if (thread_chunk != nullptr) {
+    intptr_t chunk_index = thread_chunk->chunk_index.Value();
+    if (chunk_index >= 0 &&
+        thread_chunk->chunk_index.TrySetValue(chunk_index, kChunkInUse)) {
+      TraceObject* trace_object = nullptr;
+      if (!chunks_[chunk_index]->IsFull()) {
+        trace_object = AddTraceEventToChunk(chunk_index, handle);
+      }
+      thread_chunk->chunk_index.SetValue(chunk_index);
+      if (trace_object != nullptr) return trace_object;
+    }
+  }
+  return AddTraceEventSlow(thread_chunk, handle);
+}
+
+TraceObject* TraceBufferRingBuffer::AddTraceEventSlow(ThreadChunk* thread_chunk,
+                                                      uint64_t* handle) {
   base::LockGuard<base::Mutex> guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
-    is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  if (thread_chunk == nullptr) thread_chunk = AddThreadChunk();
+  if (thread_chunk != nullptr) {
+    intptr_t chunk_index = thread_chunk->chunk_index.Value();
+    if (chunk_index != kNoChunk) {
+      if (!chunks_[chunk_index]->IsFull()) {
+        return AddTraceEventToChunk(chunk_index, handle);
+      }
+      ReleaseChunk(chunk_index);
     }
+  } else if (!is_empty_ && chunk_owner_[chunk_index_] == nullptr &&
+             !chunks_[chunk_index_]->IsFull()) {
+    // Threads without a chunk of their own share the last one under the lock.
+    return AddTraceEventToChunk(chunk_index_, handle);
   }
+
+  chunk_index_ = NextChunkToFill();
+  is_empty_ = false;
+  if (chunk_owner_[chunk_index_] != nullptr) ReleaseChunk(chunk_index_);
   auto& chunk = chunks_[chunk_index_];
+  if (chunk) {
+    chunk->Reset(current_chunk_seq_++);
+  } else {
+    chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  }
+  if (thread_chunk != nullptr) {
+    chunk_owner_[chunk_index_] = thread_chunk;
+    thread_chunk->chunk_index.SetValue(static_cast<intptr_t>(chunk_index_));
+  }
+  return AddTraceEventToChunk(chunk_index_, handle);
+}
+
+// Returns the chunk to overwrite next, which is the oldest one that no thread
+// is adding events to. Owned chunks are passed over once. If one is still
+// owned when the ring comes back to it, its owner added less than a chunk of
+// events in a whole turn of the ring or has exited, and it is taken from
+// them. When all chunks are owned the oldest one is taken.
+size_t TraceBufferRingBuffer::NextChunkToFill() {
+  if (is_empty_) return 0;
+  size_t chunk_index = NextChunkIndex(chunk_index_);
+  for (size_t i = 0; i < max_chunks_; ++i) {
+    if (chunk_owner_[chunk_index] == nullptr || chunk_skipped_[chunk_index]) {
+      break;
+    }
+    chunk_skipped_[chunk_index] = true;
+    chunk_index = NextChunkIndex(chunk_index);
+  }
+  return chunk_index;
+}
+
+void TraceBufferRingBuffer::ReleaseChunk(size_t chunk_index) {
+  ThreadChunk* owner = chunk_owner_[chunk_index];
+  // Wait for the owner to finish adding an event to the chunk.
+  intptr_t value = static_cast<intptr_t>(chunk_index);
+  while (owner->chunk_index.Value() != value ||
+         !owner->chunk_index.TrySetValue(value, kNoChunk)) {
+  }
+  // The exchange only has release semantics. Loading the value it stored
+  // acquires the events the owner added right before it.
+  CHECK_EQ(kNoChunk, owner->chunk_index.Value());
+  chunk_owner_[chunk_index] = nullptr;
+  chunk_skipped_[chunk_index] = false;
+}
+
+TraceObject* TraceBufferRingBuffer::AddTraceEventToChunk(size_t chunk_index,
+                                                         uint64_t* handle) {
+  auto& chunk = chunks_[chunk_index];
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
+  *handle = MakeHandle(chunk_index, chunk->seq(), event_index);
   return trace_object;
 }
 
+TraceBufferRingBuffer::ThreadChunk* TraceBufferRingBuffer::GetThreadChunk()
+    const {
+  return static_cast<ThreadChunk*>(
+      base::Thread::GetThreadLocal(thread_chunk_key_));
+}
+
+TraceBufferRingBuffer::ThreadChunk* TraceBufferRingBuffer::AddThreadChunk() {
+  if (thread_chunks_count_ == kMaxThreads) return nullptr;
+  ThreadChunk* thread_chunk = &thread_chunks_[thread_chunks_count_++];
+  base::Thread::SetThreadLocal(thread_chunk_key_, thread_chunk);
+  return thread_chunk;
+}
+
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::LockGuard<base::Mutex> guard(&mutex_);
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
   if (chunk_index >= chunks_.size()) return NULL;
+  // The chunk of the current thread cannot be taken while it holds it.
+  ThreadChunk* thread_chunk = GetThreadChunk();
+  intptr_t value = static_cast<intptr_t>(chunk_index);
+  if (thread_chunk != nullptr &&
+      thread_chunk->chunk_index.TrySetValue(value, kChunkInUse)) {
+    auto& chunk = chunks_[chunk_index];
+    TraceObject* trace_object =
+        chunk->seq() == chunk_seq ? chunk->GetEventAt(event_index) : NULL;
+    thread_chunk->chunk_index.SetValue(value);
+    return trace_object;
+  }
+  base::LockGuard<base::Mutex> guard(&mutex_);
   auto& chunk = chunks_[chunk_index];
   if (!chunk || chunk->seq() != chunk_seq) return NULL;
   return chunk->GetEventAt(event_index);
@@ -49,6 +151,12 @@ TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
 
 bool TraceBufferRingBuffer::Flush() {
   base::LockGuard<base::Mutex> guard(&mutex_);
+  // Threads may still be adding events when tracing has just been stopped.
+  // Take their chunks back first, they take a new chunk with their next
+  // event, which waits for the lock.
+  for (size_t i = 0; i < max_chunks_; ++i) {
+    if (chunk_owner_[i] != nullptr) ReleaseChunk(i);
+  }
   // This flushes all the traces stored in the buffer.
   if (!is_empty_) {
     for (size_t i = NextChunkIndex(chunk_index_);; i = NextChunkIndex(i)) {
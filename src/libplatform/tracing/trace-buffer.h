@@ -9,12 +9,18 @@
 #include <vector>
 
 #include "include/libplatform/v8-tracing.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 
 namespace v8 {
 namespace platform {
 namespace tracing {
 
+// Each thread adds events to a chunk of its own, so only taking a new chunk
+// needs the lock. The tracing controller flushes right after recording has
+// stopped, while threads may still be adding events, so Flush() takes the
+// chunks back from their threads first.
 class TraceBufferRingBuffer : public TraceBuffer {
  public:
   TraceBufferRingBuffer(size_t max_chunks, TraceWriter* trace_writer);
@@ -32,13 +38,40 @@ class TraceBufferRingBuffer : public TraceBuffer {
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
   size_t NextChunkIndex(size_t index) const;
 
+  // The chunk a thread adds events to. Only the owning thread adds events to
+  // it. Another thread may take it from its owner when the ring wraps, see
+  // NextChunkToFill(). The owner holds kChunkInUse while adding an event so
+  // that this never happens under its feet.
+  struct ThreadChunk {
+    ThreadChunk() : chunk_index(kNoChunk) {}
+    base::AtomicValue<intptr_t> chunk_index;
+  };
+  static const intptr_t kNoChunk = -1;
+  static const intptr_t kChunkInUse = -2;
+  // Threads find their ThreadChunk through a thread-local of this buffer.
+  // Threads beyond kMaxThreads always take the lock.
+  static const int kMaxThreads = 255;
+  ThreadChunk* GetThreadChunk() const;
+  ThreadChunk* AddThreadChunk();
+  TraceObject* AddTraceEventSlow(ThreadChunk* thread_chunk, uint64_t* handle);
+  TraceObject* AddTraceEventToChunk(size_t chunk_index, uint64_t* handle);
+  size_t NextChunkToFill();
+  void ReleaseChunk(size_t chunk_index);
+
   mutable base::Mutex mutex_;
   size_t max_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
+  // The thread adding events to the chunk at the same index, if any.
+  std::vector<ThreadChunk*> chunk_owner_;
+  // Whether the ring passed over the owned chunk at the same index once.
+  std::vector<bool> chunk_skipped_;
   size_t chunk_index_;
   bool is_empty_ = true;
   uint32_t current_chunk_seq_ = 1;
+  base::Thread::LocalStorageKey thread_chunk_key_;
+  ThreadChunk thread_chunks_[kMaxThreads];
+  int thread_chunks_count_ = 0;
 };
 
 }  // namespace tracing
@@ -171,6 +171,142 @@ TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream) {
   return new JSONTraceWriter(stream);
 }
 
+BinaryTraceWriter::BinaryTraceWriter(std::ostream& stream) : stream_(stream) {
+  buffer_.append("V8TR");
+  WriteVarint(&buffer_, kVersion);
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+  buffer_.push_back(kEndRecord);
+  Flush();
+}
+
+void BinaryTraceWriter::WriteVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void BinaryTraceWriter::AppendZigzag(int64_t value) {
+  AppendVarint((static_cast<uint64_t>(value) << 1) ^
+               static_cast<uint64_t>(value >> 63));
+}
+
+void BinaryTraceWriter::AppendString(const char* str) {
+  if (str == nullptr) {
+    AppendVarint(0);
+    return;
+  }
+  auto it = strings_.find(str);
+  if (it == strings_.end()) {
+    size_t length = strlen(str);
+    buffer_.push_back(kStringRecord);
+    WriteVarint(&buffer_, length);
+    buffer_.append(str, length);
+    it = strings_.insert(std::make_pair(std::string(str, length),
+                                        strings_.size() + 1))
+             .first;
+  }
+  AppendVarint(it->second);
+}
+
+void BinaryTraceWriter::AppendInlineString(const char* str) {
+  if (str == nullptr) {
+    AppendVarint(0);
+    return;
+  }
+  AppendInlineString(str, strlen(str));
+}
+
+void BinaryTraceWriter::AppendInlineString(const char* str, size_t length) {
+  AppendVarint(length + 1);
+  event_.append(str, length);
+}
+
+void BinaryTraceWriter::AppendArgValue(uint8_t type,
+                                       TraceObject::ArgValue value) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      AppendByte(value.as_bool ? 1 : 0);
+      break;
+    case TRACE_VALUE_TYPE_UINT:
+      AppendVarint(value.as_uint);
+      break;
+    case TRACE_VALUE_TYPE_INT:
+      AppendZigzag(value.as_int);
+      break;
+    case TRACE_VALUE_TYPE_DOUBLE: {
+      uint64_t bits;
+      memcpy(&bits, &value.as_double, sizeof(bits));
+      for (int i = 0; i < 8; ++i) {
+        AppendByte(static_cast<uint8_t>(bits >> (i * 8)));
+      }
+      break;
+    }
+    case TRACE_VALUE_TYPE_POINTER:
+      AppendVarint(reinterpret_cast<uintptr_t>(value.as_pointer));
+      break;
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      AppendInlineString(value.as_string);
+      break;
+    default:
+      UNREACHABLE();
+      break;
+  }
+}
+
+void BinaryTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  event_.clear();
+  AppendByte(kEventRecord);
+  AppendByte(static_cast<uint8_t>(trace_event->phase()));
+  AppendVarint(static_cast<uint32_t>(trace_event->pid()));
+  AppendVarint(static_cast<uint32_t>(trace_event->tid()));
+  AppendZigzag(trace_event->ts() - last_ts_);
+  AppendZigzag(trace_event->tts() - last_tts_);
+  last_ts_ = trace_event->ts();
+  last_tts_ = trace_event->tts();
+  AppendVarint(trace_event->duration());
+  AppendVarint(trace_event->cpu_duration());
+  AppendString(TracingController::GetCategoryGroupName(
+      trace_event->category_enabled_flag()));
+  AppendString(trace_event->name());
+  AppendVarint(trace_event->flags());
+  if (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID) {
+    AppendString(trace_event->scope());
+    AppendVarint(trace_event->id());
+  }
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  std::unique_ptr<v8::ConvertableToTraceFormat>* arg_convertables =
+      trace_event->arg_convertables();
+  AppendVarint(trace_event->num_args());
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    AppendString(arg_names[i]);
+    AppendByte(arg_types[i]);
+    if (arg_types[i] == TRACE_VALUE_TYPE_CONVERTABLE) {
+      std::string arg_stringified;
+      arg_convertables[i]->AppendAsTraceFormat(&arg_stringified);
+      AppendInlineString(arg_stringified.data(), arg_stringified.size());
+    } else {
+      AppendArgValue(arg_types[i], arg_values[i]);
+    }
+  }
+  buffer_.append(event_);
+}
+
+void BinaryTraceWriter::Flush() {
+  stream_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+TraceWriter* TraceWriter::CreateBinaryTraceWriter(std::ostream& stream) {
+  return new BinaryTraceWriter(stream);
+}
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
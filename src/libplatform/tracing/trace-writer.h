@@ -5,6 +5,9 @@
 #ifndef SRC_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 #define SRC_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 
+#include <string>
+#include <unordered_map>
+
 #include "include/libplatform/v8-tracing.h"
 
 namespace v8 {
@@ -26,6 +29,56 @@ class JSONTraceWriter : public TraceWriter {
   bool append_comma_ = false;
 };
 
+// Writes trace events in a compact binary format, which
+// tools/binary-trace-to-json.py converts to the JSON trace format offline.
+//
+// The stream starts with the magic "V8TR" and the format version, followed by
+// records that start with a tag byte. Numbers are unsigned LEB128 varints,
+// signed ones zigzag encoded, unless noted otherwise. Categories, names,
+// scopes and arg names are written once in a string record and referenced by
+// their number afterwards, string numbers start at 1 and 0 stands for a null
+// string. Arg values rarely repeat and are written inline instead, as their
+// length plus one (0 for a null string) followed by their bytes.
+//
+//   kStringRecord: length, bytes.
+//   kEventRecord: phase (byte), pid, tid, ts and tts (signed, relative to the
+//       previous event), duration, cpu duration, category, name, flags,
+//       scope and id if flags has TRACE_EVENT_FLAG_HAS_ID, number of args,
+//       then per arg its name, type (byte) and value. Bools are a byte,
+//       doubles 8 little-endian bytes of their bits, pointers a varint,
+//       strings and convertables (as their trace format) an inline string.
+//   kEndRecord: ends the trace.
+class BinaryTraceWriter : public TraceWriter {
+ public:
+  static const uint32_t kVersion = 2;
+  enum RecordTag : uint8_t { kEndRecord, kStringRecord, kEventRecord };
+
+  explicit BinaryTraceWriter(std::ostream& stream);
+  ~BinaryTraceWriter();
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override;
+
+ private:
+  static void WriteVarint(std::string* out, uint64_t value);
+  void AppendByte(uint8_t value) { event_.push_back(value); }
+  void AppendVarint(uint64_t value) { WriteVarint(&event_, value); }
+  void AppendZigzag(int64_t value);
+  void AppendString(const char* str);
+  void AppendInlineString(const char* str);
+  void AppendInlineString(const char* str, size_t length);
+  void AppendArgValue(uint8_t type, TraceObject::ArgValue value);
+
+  std::ostream& stream_;
+  // Records are collected here and written to the stream by Flush().
+  std::string buffer_;
+  // The event record being written. New strings it references are added to
+  // the buffer first, so readers see every string before its first use.
+  std::string event_;
+  std::unordered_map<std::string, uint64_t> strings_;
+  int64_t last_ts_ = 0;
+  int64_t last_tts_ = 0;
+};
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -27,6 +27,14 @@
 
 #include <unistd.h>
 
+#if V8_OS_LINUX
+#define USE_PERF_EVENTS
+
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#endif
+
 // GLibc on ARM defines mcontext_t has a typedef for 'struct sigcontext'.
 // Old versions of the C library <signal.h> didn't define the type.
 #if V8_OS_ANDROID && !defined(__BIONIC_HAVE_UCONTEXT_T) && \
@@ -202,17 +210,63 @@ uint32_t ThreadHash(pthread_t thread_id) {
 
 #endif  // USE_SIGNALS
 
+#if defined(USE_PERF_EVENTS)
+
+// Number of overflows after which a perf event stops signaling until it is
+// re-armed, see PERF_EVENT_IOC_REFRESH in perf_event_open(2).
+const int kPerfEventRefreshCount = 1 << 20;
+
+// Opens a disabled sampling counter for {event} on thread {tid}, counting
+// only user space. Returns -1 on failure.
+int OpenPerfEvent(Sampler::PerfEvent event, uint64_t period, pid_t tid) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  switch (event) {
+    case Sampler::kPerfTaskClock:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_TASK_CLOCK;
+      break;
+    case Sampler::kPerfCycles:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case Sampler::kPerfCacheMisses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case Sampler::kPerfBranchMisses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+  }
+  attr.sample_period = period;
+  attr.wakeup_events = 1;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+#endif  // USE_PERF_EVENTS
+
 }  // namespace
 
 #if defined(USE_SIGNALS)
 
 class Sampler::PlatformData {
  public:
-  PlatformData() : vm_tid_(pthread_self()) {}
+  PlatformData()
+      : vm_tid_(pthread_self()),
+        vm_kernel_tid_(base::OS::GetCurrentThreadId()) {}
   pthread_t vm_tid() const { return vm_tid_; }
+  // The id of the thread as used by the kernel, for perf events.
+  int vm_kernel_tid() const { return vm_kernel_tid_; }
 
  private:
   pthread_t vm_tid_;
+  int vm_kernel_tid_;
 };
 
 class SamplerManager {
@@ -404,6 +458,12 @@ void SignalHandler::HandleProfilerSignal(int signal, siginfo_t* info,
                                          void* context) {
   USE(info);
   if (signal != SIGPROF) return;
+#if defined(USE_PERF_EVENTS)
+  // The signal of a perf event that has to be re-armed.
+  if (info->si_code == POLL_HUP) {
+    ioctl(info->si_fd, PERF_EVENT_IOC_REFRESH, kPerfEventRefreshCount);
+  }
+#endif
   v8::RegisterState state;
   FillRegisterState(context, &state);
   SamplerManager::instance()->DoSample(state);
@@ -568,12 +628,14 @@ Sampler::Sampler(Isolate* isolate)
       profiling_(false),
       has_processing_thread_(false),
       active_(false),
-      registered_(false) {
+      registered_(false),
+      perf_event_fd_(-1) {
   data_ = new PlatformData;
 }
 
 Sampler::~Sampler() {
   DCHECK(!IsActive());
+  StopPerfEventSampling();
 #if defined(USE_SIGNALS)
   if (IsRegistered()) {
     SamplerManager::instance()->RemoveSampler(this);
@@ -617,6 +679,60 @@ void Sampler::DecreaseProfilingDepth() {
 }
 
 
+// static
+bool Sampler::IsPerfEventSupported(PerfEvent event) {
+#if defined(USE_PERF_EVENTS)
+  int fd = OpenPerfEvent(event, 1, 0);
+  if (fd < 0) return false;
+  close(fd);
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Sampler::StartPerfEventSampling(PerfEvent event, uint64_t period) {
+  DCHECK(!IsPerfEventSampling());
+  DCHECK_LT(0, base::NoBarrier_Load(&profiling_));
+#if defined(USE_PERF_EVENTS)
+  if (!SignalHandler::Installed()) return false;
+  int tid = platform_data()->vm_kernel_tid();
+  int fd = OpenPerfEvent(event, period, tid);
+  if (fd < 0) return false;
+  // Deliver the overflow signals as SIGPROF to the profiled thread.
+  struct f_owner_ex owner;
+  owner.type = F_OWNER_TID;
+  owner.pid = tid;
+  if (fcntl(fd, F_SETOWN_EX, &owner) != 0 ||
+      fcntl(fd, F_SETSIG, SIGPROF) != 0 ||
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_ASYNC) != 0) {
+    close(fd);
+    return false;
+  }
+  if (!IsActive() && !IsRegistered()) {
+    SamplerManager::instance()->AddSampler(this);
+    SetRegistered(true);
+  }
+  if (ioctl(fd, PERF_EVENT_IOC_REFRESH, kPerfEventRefreshCount) != 0) {
+    close(fd);
+    return false;
+  }
+  perf_event_fd_ = fd;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Sampler::StopPerfEventSampling() {
+#if defined(USE_PERF_EVENTS)
+  if (!IsPerfEventSampling()) return;
+  ioctl(perf_event_fd_, PERF_EVENT_IOC_DISABLE, 0);
+  close(perf_event_fd_);
+  perf_event_fd_ = -1;
+#endif
+}
+
 #if defined(USE_SIGNALS)
 
 void Sampler::DoSample() {
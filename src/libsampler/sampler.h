@@ -25,6 +25,15 @@ class Sampler {
   static const int kMaxFramesCountLog2 = 8;
   static const unsigned kMaxFramesCount = (1u << kMaxFramesCountLog2) - 1;
 
+  // Events counted by the kernel that can trigger samples, see
+  // StartPerfEventSampling.
+  enum PerfEvent {
+    kPerfTaskClock,  // CPU time of the thread, in nanoseconds.
+    kPerfCycles,
+    kPerfCacheMisses,
+    kPerfBranchMisses
+  };
+
   // Initializes the Sampler support. Called once at VM startup.
   static void SetUp();
   static void TearDown();
@@ -62,6 +71,19 @@ class Sampler {
 
   void DoSample();
 
+  // Whether {event} can be counted for the calling thread. Perf events are
+  // only supported on Linux, and hardware events need access to the PMU.
+  static bool IsPerfEventSupported(PerfEvent event);
+
+  // Makes the kernel signal the thread that created the sampler every
+  // {period} occurrences of {event} in user space, which takes a sample like
+  // DoSample() does. No DoSample() calls are needed while this is enabled.
+  // Returns false if the event cannot be counted. Must be called with a
+  // positive profiling depth.
+  bool StartPerfEventSampling(PerfEvent event, uint64_t period);
+  void StopPerfEventSampling();
+  bool IsPerfEventSampling() const { return perf_event_fd_ >= 0; }
+
   void SetHasProcessingThread(bool value) {
     base::NoBarrier_Store(&has_processing_thread_, value);
   }
@@ -93,6 +115,7 @@ class Sampler {
   base::Atomic32 has_processing_thread_;
   base::Atomic32 active_;
   base::Atomic32 registered_;
+  int perf_event_fd_;   // File descriptor of the perf event, or -1.
   PlatformData* data_;  // Platform specific data.
   DISALLOW_IMPLICIT_CONSTRUCTORS(Sampler);
 };
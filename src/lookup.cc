@@ -627,6 +627,11 @@ int LookupIterator::GetConstantIndex() const {
   return descriptor_number();
 }
 
+int LookupIterator::GetDictionaryEntry() const {
+  DCHECK(!holder_->IsJSGlobalObject());
+  return dictionary_entry();
+}
+
 
 FieldIndex LookupIterator::GetFieldIndex() const {
   DCHECK(has_property_);
@@ -241,6 +241,7 @@ class V8_EXPORT_PRIVATE LookupIterator final BASE_EMBEDDED {
   int GetFieldDescriptorIndex() const;
   int GetAccessorIndex() const;
   int GetConstantIndex() const;
+  int GetDictionaryEntry() const;
   Handle<PropertyCell> GetPropertyCell() const;
   Handle<Object> GetAccessors() const;
   inline Handle<InterceptorInfo> GetInterceptor() const {
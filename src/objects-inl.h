@@ -6288,7 +6288,15 @@ void SharedFunctionInfo::ReplaceCode(Code* value) {
   Code::VerifyRecompiledCode(code(), value);
 #endif  // DEBUG
 
+  bool was_interpreted = IsInterpreted();
   set_code(value);
+
+  // A bytecode flushing candidate that is no longer interpreted must not lose
+  // its bytecode, so it's evicted and revisited with the new code.
+  if (was_interpreted && !IsInterpreted()) {
+    CodeFlusher* flusher = GetHeap()->mark_compact_collector()->code_flusher();
+    if (flusher != NULL) flusher->EvictBytecodeCandidate(this);
+  }
 }
 
 bool SharedFunctionInfo::IsInterpreted() const {
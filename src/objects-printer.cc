@@ -758,53 +758,8 @@ void TypeFeedbackVector::TypeFeedbackVectorPrint(std::ostream& os) {  // NOLINT
 
     os << "\n Slot " << slot << " " << kind;
     os << " ";
-    switch (kind) {
-      case FeedbackVectorSlotKind::LOAD_IC: {
-        LoadICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::LOAD_GLOBAL_IC: {
-        LoadGlobalICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::KEYED_LOAD_IC: {
-        KeyedLoadICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::CALL_IC: {
-        CallICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::STORE_IC: {
-        StoreICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::KEYED_STORE_IC: {
-        KeyedStoreICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::INTERPRETER_BINARYOP_IC: {
-        BinaryOpICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::INTERPRETER_COMPARE_IC: {
-        CompareICNexus nexus(this, slot);
-        os << Code::ICState2String(nexus.StateFromFeedback());
-        break;
-      }
-      case FeedbackVectorSlotKind::GENERAL:
-        break;
-      case FeedbackVectorSlotKind::INVALID:
-      case FeedbackVectorSlotKind::KINDS_NUMBER:
-        UNREACHABLE();
-        break;
+    if (kind != FeedbackVectorSlotKind::GENERAL) {
+      os << Code::ICState2String(GetICState(slot));
     }
 
     int entry_size = iter.entry_size();
@@ -1608,6 +1608,10 @@ class Smi: public Object {
 
   DECLARE_CAST(Smi)
 
+  // Compares {x} and {y} as if they were converted to strings and then
+  // compared lexicographically. Returns LESS, EQUAL or GREATER.
+  static int LexicographicCompare(Smi* x, Smi* y);
+
   // Dispatched behavior.
   V8_EXPORT_PRIVATE void SmiPrint(std::ostream& os) const;  // NOLINT
   DECLARE_VERIFIER(Smi)
@@ -4240,24 +4244,37 @@ class OrderedHashTable: public FixedArray {
 
   int HashToBucket(int hash) { return hash & (NumberOfBuckets() - 1); }
 
-  int HashToEntry(int hash) {
-    int bucket = HashToBucket(hash);
-    Object* entry = this->get(kHashTableStartIndex + bucket);
-    return Smi::cast(entry)->value();
+  // The buckets and the chain fields of the entries hold links to entries.
+  // Next to the entry, a link carries a few bits of the hash of the entry's
+  // key, which allows lookups to skip entries that cannot match without
+  // loading their keys.
+  static int MakeLink(int entry, int hash) {
+    DCHECK_EQ(0, entry & ~kLinkEntryMask);
+    return (hash & kLinkHashMask) | entry;
   }
 
-  int KeyToFirstEntry(Isolate* isolate, Object* key) {
-    Object* hash = key->GetHash();
-    // If the object does not have an identity hash, it was never used as a key
-    if (hash->IsUndefined(isolate)) return kNotFound;
-    return HashToEntry(Smi::cast(hash)->value());
+  static int LinkToEntry(int link) {
+    return link == kNotFound ? kNotFound : (link & kLinkEntryMask);
   }
 
-  int NextChainEntry(int entry) {
-    Object* next_entry = get(EntryToIndex(entry) + kChainOffset);
-    return Smi::cast(next_entry)->value();
+  static bool LinkMatchesHash(int link, int hash) {
+    return (link & kLinkHashMask) == (hash & kLinkHashMask);
+  }
+
+  int HashToLink(int hash) {
+    int bucket = HashToBucket(hash);
+    Object* link = this->get(kHashTableStartIndex + bucket);
+    return Smi::cast(link)->value();
   }
 
+  int NextChainLink(int entry) {
+    Object* next_link = get(EntryToIndex(entry) + kChainOffset);
+    return Smi::cast(next_link)->value();
+  }
+
+  // Returns the entry of |key| with the given |hash|, or kNotFound.
+  int FindEntry(Object* key, int hash);
+
   // use KeyAt(i)->IsTheHole(isolate) to determine if this is a deleted entry.
   Object* KeyAt(int entry) {
     DCHECK_LT(entry, this->UsedCapacity());
@@ -4301,6 +4318,11 @@ class OrderedHashTable: public FixedArray {
   static const int kEntrySize = entrysize + 1;
   static const int kChainOffset = entrysize;
 
+  // Must match the link macros in src/js/macros.py.
+  static const int kLinkEntryBits = 25;
+  static const int kLinkEntryMask = (1 << kLinkEntryBits) - 1;
+  static const int kLinkHashMask = 0x1F << kLinkEntryBits;
+
   static const int kLoadFactor = 2;
 
   // NumberOfDeletedElements is set to kClearedTableSentinel when
@@ -4341,6 +4363,8 @@ class OrderedHashTable: public FixedArray {
   static const int kMaxCapacity =
       (FixedArray::kMaxLength - kHashTableStartIndex)
       / (1 + (kEntrySize * kLoadFactor));
+  // Capacities are powers of two, so every entry fits into a link.
+  STATIC_ASSERT(kMaxCapacity < 2 * (1 << kLinkEntryBits));
 };
 
 
@@ -7021,11 +7045,14 @@ class Script: public Struct {
   V(Date.prototype, getTime, DateGetTime)                   \
   V(Function.prototype, apply, FunctionApply)               \
   V(Function.prototype, call, FunctionCall)                 \
+  V(Map.prototype, get, MapGet)                             \
+  V(Map.prototype, has, MapHas)                             \
   V(Object.prototype, hasOwnProperty, ObjectHasOwnProperty) \
   V(RegExp.prototype, compile, RegExpCompile)               \
   V(RegExp.prototype, exec, RegExpExec)                     \
   V(RegExp.prototype, test, RegExpTest)                     \
   V(RegExp.prototype, toString, RegExpToString)             \
+  V(Set.prototype, has, SetHas)                             \
   V(String.prototype, charCodeAt, StringCharCodeAt)         \
   V(String.prototype, charAt, StringCharAt)                 \
   V(String.prototype, codePointAt, StringCodePointAt)       \
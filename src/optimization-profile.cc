@@ -0,0 +1,188 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/optimization-profile.h"
+
+#include <vector>
+
+#include "src/handles-inl.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The serialized profile is a sequence of uint32_t values: a header followed
+// by one fixed-size record per function.
+const uint32_t kMagicNumber = 0x4F505446;  // "OPTF"
+const int kMagicOffset = 0;
+const int kVersionHashOffset = 1;
+const int kEntryCountOffset = 2;
+const int kHeaderLength = 3;
+
+const int kSourceHashOffset = 0;
+const int kSourceLengthOffset = 1;
+const int kStartPositionOffset = 2;
+const int kEndPositionOffset = 3;
+const int kCountsOffset = 4;
+const int kEntryLength = 5;
+
+const uint32_t kMaxCount = 0xFFFF;
+
+uint32_t PackCounts(int opt_count, int deopt_count) {
+  uint32_t opt = Min(static_cast<uint32_t>(opt_count), kMaxCount);
+  uint32_t deopt = Min(static_cast<uint32_t>(deopt_count), kMaxCount);
+  return (opt << 16) | deopt;
+}
+
+}  // namespace
+
+bool OptimizationProfile::Key::operator<(const Key& other) const {
+  if (source_hash != other.source_hash) return source_hash < other.source_hash;
+  if (source_length != other.source_length) {
+    return source_length < other.source_length;
+  }
+  if (start_position != other.start_position) {
+    return start_position < other.start_position;
+  }
+  return end_position < other.end_position;
+}
+
+// static
+bool OptimizationProfile::ComputeSourceHash(Script* script, uint32_t* hash) {
+  DisallowHeapAllocation no_gc;
+  if (!script->source()->IsString()) return false;
+  String* source = String::cast(script->source());
+  String::FlatContent content = source->GetFlatContent();
+  if (!content.IsFlat()) return false;
+  // The string hash of the heap is randomly seeded and gives up on long
+  // strings, so compute a stable hash over the whole source instead.
+  uint32_t running_hash = 0;
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    running_hash = StringHasher::ComputeRunningHashOneByte(
+        running_hash, reinterpret_cast<const char*>(chars.start()),
+        chars.length());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    running_hash = StringHasher::ComputeRunningHash(running_hash, chars.start(),
+                                                    chars.length());
+  }
+  *hash = StringHasher::GetHashCore(running_hash);
+  return true;
+}
+
+bool OptimizationProfile::LookupSourceHash(Script* script, uint32_t* hash) {
+  auto it = source_hashes_.find(script->id());
+  if (it != source_hashes_.end()) {
+    *hash = it->second;
+    return true;
+  }
+  if (!ComputeSourceHash(script, hash)) return false;
+  // Hashing is cheap compared to optimizing, so simply start over once the
+  // cache is full.
+  if (source_hashes_.size() >= kMaxCachedSourceHashes) source_hashes_.clear();
+  source_hashes_.insert(std::make_pair(script->id(), *hash));
+  return true;
+}
+
+// static
+StartupData OptimizationProfile::Create(Isolate* isolate) {
+  HandleScope scope(isolate);
+  std::vector<Handle<Script>> scripts;
+  {
+    Script::Iterator iterator(isolate);
+    while (Script* script = iterator.Next()) {
+      if (script->type() != Script::TYPE_NORMAL) continue;
+      if (!script->source()->IsString()) continue;
+      scripts.push_back(handle(script, isolate));
+    }
+  }
+
+  std::vector<uint32_t> words(kHeaderLength);
+  words[kMagicOffset] = kMagicNumber;
+  words[kVersionHashOffset] = Version::Hash();
+  for (Handle<Script> script : scripts) {
+    Handle<String> source(String::cast(script->source()), isolate);
+    String::Flatten(source);
+    uint32_t source_hash;
+    if (!ComputeSourceHash(*script, &source_hash)) continue;
+
+    DisallowHeapAllocation no_gc;
+    SharedFunctionInfo::ScriptIterator iterator(script);
+    while (SharedFunctionInfo* shared = iterator.Next()) {
+      if (shared->opt_count() == 0) continue;
+      words.push_back(source_hash);
+      words.push_back(static_cast<uint32_t>(source->length()));
+      words.push_back(static_cast<uint32_t>(shared->start_position()));
+      words.push_back(static_cast<uint32_t>(shared->end_position()));
+      words.push_back(PackCounts(shared->opt_count(), shared->deopt_count()));
+    }
+  }
+  DCHECK_EQ(0, (words.size() - kHeaderLength) % kEntryLength);
+  words[kEntryCountOffset] =
+      static_cast<uint32_t>((words.size() - kHeaderLength) / kEntryLength);
+
+  int length = static_cast<int>(words.size() * sizeof(uint32_t));
+  char* data = new char[length];
+  MemCopy(data, words.data(), length);
+  StartupData result = {data, length};
+  return result;
+}
+
+// static
+OptimizationProfile* OptimizationProfile::Deserialize(const char* data,
+                                                      int length) {
+  const int kWordSize = static_cast<int>(sizeof(uint32_t));
+  if (data == nullptr || length < kHeaderLength * kWordSize ||
+      length % kWordSize != 0) {
+    return nullptr;
+  }
+  std::vector<uint32_t> words(length / kWordSize);
+  MemCopy(words.data(), data, length);
+  if (words[kMagicOffset] != kMagicNumber) return nullptr;
+  if (words[kVersionHashOffset] != Version::Hash()) return nullptr;
+  size_t entry_count = words[kEntryCountOffset];
+  if (words.size() != kHeaderLength + entry_count * kEntryLength) {
+    return nullptr;
+  }
+
+  OptimizationProfile* profile = new OptimizationProfile();
+  for (size_t i = kHeaderLength; i < words.size(); i += kEntryLength) {
+    Key key = {words[i + kSourceHashOffset], words[i + kSourceLengthOffset],
+               words[i + kStartPositionOffset], words[i + kEndPositionOffset]};
+    // Skip entries that cannot describe a function, they will not match.
+    if (key.start_position > key.end_position ||
+        key.end_position > key.source_length) {
+      continue;
+    }
+    uint32_t counts = words[i + kCountsOffset];
+    Entry entry = {static_cast<uint16_t>(counts >> 16),
+                   static_cast<uint16_t>(counts & kMaxCount)};
+    profile->entries_[key] = entry;
+  }
+  return profile;
+}
+
+bool OptimizationProfile::IsHot(SharedFunctionInfo* shared) {
+  DisallowHeapAllocation no_gc;
+  if (entries_.empty() || !shared->script()->IsScript()) return false;
+  Script* script = Script::cast(shared->script());
+  uint32_t source_hash;
+  if (!LookupSourceHash(script, &source_hash)) return false;
+  Key key = {source_hash,
+             static_cast<uint32_t>(String::cast(script->source())->length()),
+             static_cast<uint32_t>(shared->start_position()),
+             static_cast<uint32_t>(shared->end_position())};
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return false;
+  const Entry& entry = it->second;
+  return entry.opt_count > 0 && entry.deopt_count < FLAG_max_opt_count;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,86 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPTIMIZATION_PROFILE_H_
+#define V8_OPTIMIZATION_PROFILE_H_
+
+#include <map>
+#include <unordered_map>
+
+#include "include/v8.h"
+#include "src/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Script;
+class SharedFunctionInfo;
+
+// A compact record of the optimization history of the functions in an
+// isolate. It can be carried over into a later process, where the runtime
+// profiler uses it to optimize functions that were hot in the profiled run
+// without waiting for them to accumulate profiler ticks first.
+//
+// Functions are identified structurally by a hash over the source of their
+// script together with their source range, so the profile stays valid across
+// processes. Entries that no longer match any function are never found.
+//
+// Only the optimization and deoptimization counts are recorded. Maps and call
+// targets are not, since feedback vectors refer to heap objects that do not
+// exist in the later process.
+class OptimizationProfile {
+ public:
+  // Serializes the optimization history of all user functions in {isolate}.
+  // The caller takes ownership of the returned data.
+  static StartupData Create(Isolate* isolate);
+
+  // Returns nullptr if {data} is malformed or was created by a different
+  // version of V8.
+  static OptimizationProfile* Deserialize(const char* data, int length);
+
+  // Whether {shared} was optimized in the profiled run without running into
+  // excessive deoptimization. Does not allocate on the JavaScript heap.
+  bool IsHot(SharedFunctionInfo* shared);
+
+  int length() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  struct Key {
+    uint32_t source_hash;
+    uint32_t source_length;
+    uint32_t start_position;
+    uint32_t end_position;
+
+    bool operator<(const Key& other) const;
+  };
+
+  struct Entry {
+    uint16_t opt_count;
+    uint16_t deopt_count;
+  };
+
+  OptimizationProfile() {}
+
+  // Computes the source hash of {script}, or returns false if its source is
+  // not available as a flat string.
+  static bool ComputeSourceHash(Script* script, uint32_t* hash);
+  bool LookupSourceHash(Script* script, uint32_t* hash);
+
+  // Upper bound for the number of cached source hashes, so that isolates
+  // which keep evaluating new scripts don't grow the cache without limit.
+  static const size_t kMaxCachedSourceHashes = 256;
+
+  std::map<Key, Entry> entries_;
+  // Source hashes of the scripts looked up recently, keyed by script id. The
+  // profile is only used with a single isolate, in which ids are unique.
+  std::unordered_map<int, uint32_t> source_hashes_;
+
+  DISALLOW_COPY_AND_ASSIGN(OptimizationProfile);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OPTIMIZATION_PROFILE_H_
@@ -2645,7 +2645,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
              scope->start_position(), scope->end_position(),
              function_name->byte_length(), function_name->raw_data());
     }
-    if (V8_UNLIKELY(FLAG_runtime_stats)) {
+    if (V8_UNLIKELY(RuntimeCallStats::IsEnabled(runtime_call_stats_))) {
       if (is_lazy_top_level_function) {
         RuntimeCallStats::CorrectCurrentCounterId(
             runtime_call_stats_,
@@ -3527,6 +3527,10 @@ void Parser::ParseOnBackground(ParseInfo* info) {
   if (FLAG_runtime_stats) {
     // Create separate runtime stats for background parsing.
     runtime_call_stats_ = new (zone()) RuntimeCallStats();
+  } else {
+    // The isolate's stats may still be sampling, but only the main thread
+    // updates them.
+    runtime_call_stats_ = nullptr;
   }
 
   std::unique_ptr<Utf16CharacterStream> stream;
@@ -53,6 +53,7 @@ ProfilerEventsProcessor::ProfilerEventsProcessor(Isolate* isolate,
 }
 
 ProfilerEventsProcessor::~ProfilerEventsProcessor() {
+  sampler_->StopPerfEventSampling();
   sampler_->DecreaseProfilingDepth();
 }
 
@@ -171,8 +172,9 @@ void ProfilerEventsProcessor::Run() {
 #endif
     }
 
-    // Schedule next sample. sampler_ is NULL in tests.
-    if (sampler_) sampler_->DoSample();
+    // Schedule next sample, unless the kernel triggers samples on perf
+    // events. sampler_ is NULL in tests.
+    if (sampler_ && !sampler_->IsPerfEventSampling()) sampler_->DoSample();
   }
 
   // Process remaining tick events.
@@ -245,6 +247,9 @@ CpuProfiler::CpuProfiler(Isolate* isolate)
     : isolate_(isolate),
       sampling_interval_(base::TimeDelta::FromMicroseconds(
           FLAG_cpu_profiler_sampling_interval)),
+      use_sampling_event_(false),
+      sampling_event_(sampler::Sampler::kPerfTaskClock),
+      sampling_event_period_(0),
       profiles_(new CpuProfilesCollection(isolate)),
       is_profiling_(false) {
   profiles_->set_cpu_profiler(this);
@@ -256,6 +261,9 @@ CpuProfiler::CpuProfiler(Isolate* isolate, CpuProfilesCollection* test_profiles,
     : isolate_(isolate),
       sampling_interval_(base::TimeDelta::FromMicroseconds(
           FLAG_cpu_profiler_sampling_interval)),
+      use_sampling_event_(false),
+      sampling_event_(sampler::Sampler::kPerfTaskClock),
+      sampling_event_period_(0),
       profiles_(test_profiles),
       generator_(test_generator),
       processor_(test_processor),
@@ -272,6 +280,23 @@ void CpuProfiler::set_sampling_interval(base::TimeDelta value) {
   sampling_interval_ = value;
 }
 
+bool CpuProfiler::set_sampling_event(sampler::Sampler::PerfEvent event,
+                                     uint64_t period) {
+  DCHECK(!is_profiling_);
+  if (period == 0 || !sampler::Sampler::IsPerfEventSupported(event)) {
+    return false;
+  }
+  use_sampling_event_ = true;
+  sampling_event_ = event;
+  sampling_event_period_ = period;
+  return true;
+}
+
+void CpuProfiler::clear_sampling_event() {
+  DCHECK(!is_profiling_);
+  use_sampling_event_ = false;
+}
+
 void CpuProfiler::ResetProfiles() {
   profiles_.reset(new CpuProfilesCollection(isolate_));
   profiles_->set_cpu_profiler(this);
@@ -296,6 +321,27 @@ void CpuProfiler::StartProfiling(String* title, bool record_samples) {
 }
 
 
+void CpuProfiler::StartContinuousProfiling(const char* title,
+                                           unsigned max_nodes) {
+  DCHECK_LT(0u, max_nodes);
+  if (profiles_->StartProfiling(title, false, max_nodes)) {
+    StartProcessorIfNotStarted();
+  }
+}
+
+void CpuProfiler::StartContinuousProfiling(String* title, unsigned max_nodes) {
+  StartContinuousProfiling(profiles_->GetName(title), max_nodes);
+  isolate_->debug()->feature_tracker()->Track(DebugFeatureTracker::kProfiler);
+}
+
+CpuProfileDelta* CpuProfiler::TakeProfileDelta(const char* title) {
+  return profiles_->TakeProfileDelta(title);
+}
+
+CpuProfileDelta* CpuProfiler::TakeProfileDelta(String* title) {
+  return TakeProfileDelta(profiles_->GetName(title));
+}
+
 void CpuProfiler::StartProcessorIfNotStarted() {
   if (processor_) {
     processor_->AddCurrentStack(isolate_);
@@ -321,7 +367,12 @@ void CpuProfiler::StartProcessorIfNotStarted() {
   logger->LogCompiledFunctions();
   logger->LogAccessorCallbacks();
   LogBuiltins();
-  // Enable stack sampling.
+  // Enable stack sampling. If the sampling event cannot be counted after all,
+  // the processor falls back to sampling at the sampling interval.
+  if (use_sampling_event_) {
+    processor_->sampler()->StartPerfEventSampling(sampling_event_,
+                                                  sampling_event_period_);
+  }
   processor_->AddCurrentStack(isolate_);
   processor_->StartSynchronously();
 }
@@ -25,6 +25,7 @@ namespace internal {
 class CodeEntry;
 class CodeMap;
 class CpuProfile;
+class CpuProfileDelta;
 class CpuProfilesCollection;
 class ProfileGenerator;
 
@@ -196,9 +197,17 @@ class CpuProfiler : public CodeEventObserver {
   ~CpuProfiler() override;
 
   void set_sampling_interval(base::TimeDelta value);
+  // Makes samples be triggered by {event} instead of the sampling interval.
+  // Returns false if the event cannot be counted.
+  bool set_sampling_event(sampler::Sampler::PerfEvent event, uint64_t period);
+  void clear_sampling_event();
   void CollectSample();
   void StartProfiling(const char* title, bool record_samples = false);
   void StartProfiling(String* title, bool record_samples);
+  void StartContinuousProfiling(const char* title, unsigned max_nodes);
+  void StartContinuousProfiling(String* title, unsigned max_nodes);
+  CpuProfileDelta* TakeProfileDelta(const char* title);
+  CpuProfileDelta* TakeProfileDelta(String* title);
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String* title);
   int GetProfilesCount();
@@ -223,6 +232,9 @@ class CpuProfiler : public CodeEventObserver {
 
   Isolate* const isolate_;
   base::TimeDelta sampling_interval_;
+  bool use_sampling_event_;
+  sampler::Sampler::PerfEvent sampling_event_;
+  uint64_t sampling_event_period_;
   std::unique_ptr<CpuProfilesCollection> profiles_;
   std::unique_ptr<ProfileGenerator> generator_;
   std::unique_ptr<ProfilerEventsProcessor> processor_;
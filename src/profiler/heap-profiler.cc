@@ -84,6 +84,30 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver) {
+  bool result;
+  {
+    // The snapshot only lives as long as its nodes are needed, it is never
+    // added to the list of snapshots.
+    HeapSnapshot snapshot(this);
+    HeapSnapshotBinaryWriter writer(stream);
+    snapshot.set_binary_writer(&writer);
+    HeapSnapshotGenerator generator(&snapshot, control, resolver, heap());
+    result = generator.GenerateSnapshot();
+    if (result) writer.WriteNodesAndFinalize(&snapshot);
+    result = result && !writer.aborted();
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return result;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -4,6 +4,9 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <utility>
+#include <vector>
+
 #include "src/code-stubs.h"
 #include "src/conversions.h"
 #include "src/debug/debug.h"
@@ -62,8 +65,12 @@ HeapEntry::HeapEntry(HeapSnapshot* snapshot,
 void HeapEntry::SetNamedReference(HeapGraphEdge::Type type,
                                   const char* name,
                                   HeapEntry* entry) {
-  HeapGraphEdge edge(type, name, this->index(), entry->index());
-  snapshot_->edges().push_back(edge);
+  if (HeapSnapshotBinaryWriter* writer = snapshot_->binary_writer()) {
+    writer->WriteNamedEdge(type, this->index(), name, entry->index());
+  } else {
+    HeapGraphEdge edge(type, name, this->index(), entry->index());
+    snapshot_->edges().push_back(edge);
+  }
   ++children_count_;
 }
 
@@ -71,8 +78,12 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type,
 void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type,
                                     int index,
                                     HeapEntry* entry) {
-  HeapGraphEdge edge(type, index, this->index(), entry->index());
-  snapshot_->edges().push_back(edge);
+  if (HeapSnapshotBinaryWriter* writer = snapshot_->binary_writer()) {
+    writer->WriteIndexedEdge(type, this->index(), index, entry->index());
+  } else {
+    HeapGraphEdge edge(type, index, this->index(), entry->index());
+    snapshot_->edges().push_back(edge);
+  }
   ++children_count_;
 }
 
@@ -181,7 +192,8 @@ HeapSnapshot::HeapSnapshot(HeapProfiler* profiler)
     : profiler_(profiler),
       root_index_(HeapEntry::kNoEntry),
       gc_roots_index_(HeapEntry::kNoEntry),
-      max_snapshot_js_object_id_(0) {
+      max_snapshot_js_object_id_(0),
+      binary_writer_(nullptr) {
   STATIC_ASSERT(
       sizeof(HeapGraphEdge) ==
       SnapshotSizeConstants<kPointerSize>::kExpectedHeapGraphEdgeSize);
@@ -328,6 +340,152 @@ List<HeapEntry*>* HeapSnapshot::GetSortedEntriesList() {
 }
 
 
+HeapEntry* HeapSnapshot::GetDominator(HeapEntry* entry) {
+  if (dominators_.is_empty()) ComputeDominators();
+  int index = dominators_[entry->index()];
+  return index == HeapEntry::kNoEntry ? NULL : &entries_[index];
+}
+
+
+size_t HeapSnapshot::GetRetainedSize(HeapEntry* entry) {
+  if (retained_sizes_.is_empty()) ComputeDominators();
+  return retained_sizes_[entry->index()];
+}
+
+
+// Computes the dominator tree with the semi-NCA variant of the
+// Lengauer-Tarjan algorithm (Georgiadis, "Linear-Time Algorithms for
+// Dominators and Related Problems", 2005). Unlike a fixpoint iteration over
+// all entries it visits every edge a constant number of times, apart from the
+// path compression, and does not recurse so deep graphs are fine.
+void HeapSnapshot::ComputeDominators() {
+  DCHECK_NULL(binary_writer_);
+  DCHECK_EQ(edges_.size(), children_.size());
+  const int kNone = -1;
+  int entries_count = entries_.length();
+
+  // Pack the retaining edges into compressed sparse row form, so that the
+  // passes below do not chase edge pointers.
+  std::vector<int> offsets(entries_count + 1);
+  std::vector<int> targets;
+  targets.reserve(edges_.size());
+  for (int i = 0; i < entries_count; ++i) {
+    offsets[i] = static_cast<int>(targets.size());
+    HeapEntry* entry = &entries_[i];
+    for (int j = 0; j < entry->children_count(); ++j) {
+      HeapGraphEdge* edge = entry->child(j);
+      if (edge->type() == HeapGraphEdge::kWeak) continue;
+      targets.push_back(edge->to()->index());
+    }
+  }
+  offsets[entries_count] = static_cast<int>(targets.size());
+
+  // Number the entries reachable from the root in depth-first preorder. All
+  // arrays below are indexed by preorder number, |vertex| maps back to entry
+  // indexes and |parent| is the parent in the depth-first spanning tree.
+  std::vector<int> preorder(entries_count, kNone);
+  std::vector<int> vertex;
+  std::vector<int> parent;
+  vertex.reserve(entries_count);
+  parent.reserve(entries_count);
+  {
+    // Pairs of the preorder number and the next edge offset to visit.
+    std::vector<std::pair<int, int>> stack;
+    preorder[root_index_] = 0;
+    vertex.push_back(root_index_);
+    parent.push_back(0);
+    stack.push_back(std::make_pair(0, offsets[root_index_]));
+    while (!stack.empty()) {
+      int v = stack.back().first;
+      int next = stack.back().second;
+      int end = offsets[vertex[v] + 1];
+      while (next < end && preorder[targets[next]] != kNone) ++next;
+      if (next == end) {
+        stack.pop_back();
+        continue;
+      }
+      stack.back().second = next + 1;
+      int w = targets[next];
+      int number = static_cast<int>(vertex.size());
+      preorder[w] = number;
+      vertex.push_back(w);
+      parent.push_back(v);
+      stack.push_back(std::make_pair(number, offsets[w]));
+    }
+  }
+  int count = static_cast<int>(vertex.size());
+
+  // Predecessors of the reachable entries, also in compressed sparse row
+  // form. Edges from unreachable entries do not affect dominance.
+  std::vector<int> pred_offsets(count + 1, 0);
+  for (int v = 0; v < count; ++v) {
+    for (int k = offsets[vertex[v]]; k < offsets[vertex[v] + 1]; ++k) {
+      ++pred_offsets[preorder[targets[k]] + 1];
+    }
+  }
+  for (int v = 0; v < count; ++v) pred_offsets[v + 1] += pred_offsets[v];
+  std::vector<int> preds(pred_offsets[count]);
+  {
+    std::vector<int> fill(pred_offsets.begin(), pred_offsets.end() - 1);
+    for (int v = 0; v < count; ++v) {
+      for (int k = offsets[vertex[v]]; k < offsets[vertex[v] + 1]; ++k) {
+        preds[fill[preorder[targets[k]]]++] = v;
+      }
+    }
+  }
+
+  // Compute semidominators in reverse preorder. |ancestor| and |label| form
+  // the link-eval forest, |label| is the vertex with the smallest
+  // semidominator on the compressed path to the forest root.
+  std::vector<int> semi(count);
+  std::vector<int> label(count);
+  std::vector<int> ancestor(count, kNone);
+  for (int v = 0; v < count; ++v) semi[v] = label[v] = v;
+  std::vector<int> path;
+  for (int w = count - 1; w > 0; --w) {
+    for (int k = pred_offsets[w]; k < pred_offsets[w + 1]; ++k) {
+      int v = preds[k];
+      if (ancestor[v] != kNone) {
+        for (int u = v; ancestor[ancestor[u]] != kNone; u = ancestor[u]) {
+          path.push_back(u);
+        }
+        while (!path.empty()) {
+          int u = path.back();
+          path.pop_back();
+          int a = ancestor[u];
+          if (semi[label[a]] < semi[label[u]]) label[u] = label[a];
+          ancestor[u] = ancestor[a];
+        }
+        v = label[v];
+      }
+      semi[w] = Min(semi[w], semi[v]);
+    }
+    ancestor[w] = parent[w];
+  }
+
+  // The immediate dominator is the nearest common ancestor of the parent and
+  // the semidominator in the spanning tree, walk it up in preorder.
+  std::vector<int> idom(parent);
+  for (int w = 1; w < count; ++w) {
+    while (idom[w] > semi[w]) idom[w] = idom[idom[w]];
+  }
+
+  // Dominators precede the entries they dominate in preorder, so a reverse
+  // preorder pass accumulates complete retained sizes.
+  dominators_.AddBlock(HeapEntry::kNoEntry, entries_count);
+  retained_sizes_.Allocate(entries_count);
+  for (int i = 0; i < entries_count; ++i) {
+    retained_sizes_[i] = entries_[i].self_size();
+  }
+  for (int w = count - 1; w > 0; --w) {
+    int entry = vertex[w];
+    int dominator = vertex[idom[w]];
+    dominators_[entry] = dominator;
+    retained_sizes_[dominator] += retained_sizes_[entry];
+  }
+}
+
+
 void HeapSnapshot::Print(int max_depth) {
   root()->Print("", "", max_depth, 0);
 }
@@ -337,7 +495,9 @@ size_t HeapSnapshot::RawSnapshotSize() const {
   return sizeof(*this) + GetMemoryUsedByList(entries_) +
          edges_.size() * sizeof(decltype(edges_)::value_type) +
          children_.size() * sizeof(decltype(children_)::value_type) +
-         GetMemoryUsedByList(sorted_entries_);
+         GetMemoryUsedByList(sorted_entries_) +
+         GetMemoryUsedByList(dominators_) +
+         GetMemoryUsedByList(retained_sizes_);
 }
 
 
@@ -2520,7 +2680,8 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  // A streamed snapshot has no edges to index.
+  if (!snapshot_->binary_writer()) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2536,6 +2697,8 @@ void HeapSnapshotGenerator::ProgressStep() {
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
   const int kProgressReportGranularity = 10000;
+  HeapSnapshotBinaryWriter* binary_writer = snapshot_->binary_writer();
+  if (binary_writer && binary_writer->aborted()) return false;
   if (control_ != NULL
       && (force || progress_counter_ % kProgressReportGranularity == 0)) {
       return
@@ -2609,6 +2772,12 @@ class OutputStreamWriter {
     }
   }
   void AddNumber(unsigned n) { AddNumberImpl<unsigned>(n, "%u"); }
+  // Unlike AddCharacter, also accepts '\0' as part of binary data.
+  void AddByte(uint8_t b) {
+    DCHECK(chunk_pos_ < chunk_size_);
+    chunk_[chunk_pos_++] = static_cast<char>(b);
+    MaybeWriteChunk();
+  }
   void Finalize() {
     if (aborted_) return;
     DCHECK(chunk_pos_ < chunk_size_);
@@ -3116,5 +3285,97 @@ void HeapSnapshotJSONSerializer::SerializeStrings() {
 }
 
 
+namespace {
+
+bool BinaryWriterStringsMatch(void* key1, void* key2) {
+  return strcmp(reinterpret_cast<char*>(key1),
+                reinterpret_cast<char*>(key2)) == 0;
+}
+
+uint32_t BinaryWriterStringHash(const char* s) {
+  return StringHasher::HashSequentialString(s, StrLength(s),
+                                            v8::internal::kZeroHashSeed);
+}
+
+}  // namespace
+
+const char HeapSnapshotBinaryWriter::kMagic[] = "V8HS";
+
+HeapSnapshotBinaryWriter::HeapSnapshotBinaryWriter(v8::OutputStream* stream)
+    : strings_(BinaryWriterStringsMatch),
+      next_string_id_(1),
+      last_edge_from_(0),
+      writer_(new OutputStreamWriter(stream)) {
+  writer_->AddString(kMagic);
+  WriteVarint(kVersion);
+}
+
+HeapSnapshotBinaryWriter::~HeapSnapshotBinaryWriter() { delete writer_; }
+
+bool HeapSnapshotBinaryWriter::aborted() { return writer_->aborted(); }
+
+void HeapSnapshotBinaryWriter::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    writer_->AddByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  writer_->AddByte(static_cast<uint8_t>(value));
+}
+
+int HeapSnapshotBinaryWriter::GetStringId(const char* s) {
+  base::HashMap::Entry* cache_entry =
+      strings_.LookupOrInsert(const_cast<char*>(s), BinaryWriterStringHash(s));
+  if (cache_entry->value == NULL) {
+    cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
+    int length = StrLength(s);
+    writer_->AddByte(kStringRecord);
+    WriteVarint(length);
+    writer_->AddSubstring(s, length);
+  }
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
+void HeapSnapshotBinaryWriter::WriteEdge(HeapGraphEdge::Type type, int from,
+                                         uint32_t name_or_index, int to) {
+  // The edges of an object are added together, so the delta of the from
+  // index is mostly zero.
+  int64_t delta = static_cast<int64_t>(from) - last_edge_from_;
+  last_edge_from_ = from;
+  writer_->AddByte(kEdgeRecord);
+  WriteVarint(type);
+  WriteVarint(static_cast<uint64_t>((delta << 1) ^ (delta >> 63)));
+  WriteVarint(name_or_index);
+  WriteVarint(to);
+}
+
+void HeapSnapshotBinaryWriter::WriteNamedEdge(HeapGraphEdge::Type type,
+                                              int from, const char* name,
+                                              int to) {
+  // The string record has to precede the edge record.
+  WriteEdge(type, from, GetStringId(name), to);
+}
+
+void HeapSnapshotBinaryWriter::WriteIndexedEdge(HeapGraphEdge::Type type,
+                                                int from, int index, int to) {
+  WriteEdge(type, from, index, to);
+}
+
+void HeapSnapshotBinaryWriter::WriteNodesAndFinalize(HeapSnapshot* snapshot) {
+  List<HeapEntry>& entries = snapshot->entries();
+  for (int i = 0; i < entries.length() && !writer_->aborted(); ++i) {
+    HeapEntry* entry = &entries[i];
+    int name_id = GetStringId(entry->name());
+    writer_->AddByte(kNodeRecord);
+    WriteVarint(entry->type());
+    WriteVarint(name_id);
+    WriteVarint(entry->id());
+    WriteVarint(entry->self_size());
+    WriteVarint(entry->trace_node_id());
+  }
+  writer_->AddByte(kEndRecord);
+  writer_->Finalize();
+}
+
+
 }  // namespace internal
 }  // namespace v8
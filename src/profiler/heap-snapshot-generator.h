@@ -22,6 +22,7 @@ class HeapEntry;
 class HeapIterator;
 class HeapProfiler;
 class HeapSnapshot;
+class HeapSnapshotBinaryWriter;
 class SnapshotFiller;
 
 class HeapGraphEdge BASE_EMBEDDED {
@@ -181,12 +182,27 @@ class HeapSnapshot {
   List<HeapEntry*>* GetSortedEntriesList();
   void FillChildren();
 
+  // The immediate dominator of |entry| and the total size of the entries it
+  // dominates, including itself. Both are computed for all entries on first
+  // use. Weak edges do not retain their targets, so entries only reachable
+  // through them have no dominator and retain just their own size.
+  HeapEntry* GetDominator(HeapEntry* entry);
+  size_t GetRetainedSize(HeapEntry* entry);
+
+  // A snapshot with a binary writer does not keep its edges, they are
+  // written to the stream as they are added.
+  HeapSnapshotBinaryWriter* binary_writer() const { return binary_writer_; }
+  void set_binary_writer(HeapSnapshotBinaryWriter* writer) {
+    binary_writer_ = writer;
+  }
+
   void Print(int max_depth);
 
  private:
   HeapEntry* AddRootEntry();
   HeapEntry* AddGcRootsEntry();
   HeapEntry* AddGcSubrootEntry(int tag, SnapshotObjectId id);
+  void ComputeDominators();
 
   HeapProfiler* profiler_;
   int root_index_;
@@ -196,7 +212,11 @@ class HeapSnapshot {
   std::deque<HeapGraphEdge> edges_;
   std::deque<HeapGraphEdge*> children_;
   List<HeapEntry*> sorted_entries_;
+  // Indexed by entry index, filled in by ComputeDominators().
+  List<int> dominators_;
+  List<size_t> retained_sizes_;
   SnapshotObjectId max_snapshot_js_object_id_;
+  HeapSnapshotBinaryWriter* binary_writer_;
 
   friend class HeapSnapshotTester;
 
@@ -625,6 +645,50 @@ class HeapSnapshotJSONSerializer {
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotJSONSerializer);
 };
 
+// Writes a heap snapshot in a compact binary format while it is being
+// generated. After the magic number "V8HS" and the format version, the
+// stream is a sequence of records, each a tag byte followed by unsigned
+// LEB128 varints:
+//   kStringRecord: length, UTF-8 characters. Strings get ids 1, 2, ...
+//   kEdgeRecord: type, from node index as zigzag delta to the previous
+//                edge, string id of the name or element index, to node index.
+//   kNodeRecord: type, string id of the name, id, self size, trace node id.
+//                Nodes get indices 0, 1, ...
+//   kEndRecord
+// Each string is written before its first use. Nodes follow all edges, as
+// their names may change until the heap has been walked completely.
+// tools/heap-snapshot-to-json.py converts the output to the JSON format.
+class HeapSnapshotBinaryWriter {
+ public:
+  enum RecordTag { kEndRecord, kStringRecord, kEdgeRecord, kNodeRecord };
+  static const char kMagic[];
+  static const int kVersion = 1;
+
+  explicit HeapSnapshotBinaryWriter(v8::OutputStream* stream);
+  ~HeapSnapshotBinaryWriter();
+
+  void WriteNamedEdge(HeapGraphEdge::Type type, int from, const char* name,
+                      int to);
+  void WriteIndexedEdge(HeapGraphEdge::Type type, int from, int index,
+                        int to);
+  // Writes the nodes and ends the stream.
+  void WriteNodesAndFinalize(HeapSnapshot* snapshot);
+  bool aborted();
+
+ private:
+  int GetStringId(const char* s);
+  void WriteEdge(HeapGraphEdge::Type type, int from, uint32_t name_or_index,
+                 int to);
+  void WriteVarint(uint64_t value);
+
+  base::CustomMatcherHashMap strings_;
+  int next_string_id_;
+  int last_edge_from_;
+  OutputStreamWriter* writer_;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotBinaryWriter);
+};
+
 
 }  // namespace internal
 }  // namespace v8
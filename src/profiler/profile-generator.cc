@@ -290,11 +290,13 @@ class DeleteNodesCallback {
   void AfterChildTraversed(ProfileNode*, ProfileNode*) { }
 };
 
-ProfileTree::ProfileTree(Isolate* isolate)
+ProfileTree::ProfileTree(Isolate* isolate, unsigned max_nodes)
     : root_entry_(CodeEventListener::FUNCTION_TAG, "(root)"),
       next_node_id_(1),
       root_(new ProfileNode(this, &root_entry_, nullptr)),
       isolate_(isolate),
+      max_nodes_(max_nodes),
+      truncated_ticks_count_(0),
       next_function_id_(1),
       function_ids_(ProfileNode::CodeEntriesMatch) {}
 
@@ -318,15 +320,26 @@ ProfileNode* ProfileTree::AddPathFromEnd(const std::vector<CodeEntry*>& path,
                                          int src_line, bool update_stats) {
   ProfileNode* node = root_;
   CodeEntry* last_entry = NULL;
+  bool truncated = false;
   for (auto it = path.rbegin(); it != path.rend(); ++it) {
     if (*it == NULL) continue;
+    if (max_nodes_ && nodes_count() >= max_nodes_) {
+      ProfileNode* child = node->FindChild(*it);
+      if (!child) {
+        truncated = true;
+        break;
+      }
+      node = child;
+    } else {
+      node = node->FindOrAddChild(*it);
+    }
     last_entry = *it;
-    node = node->FindOrAddChild(*it);
   }
-  if (last_entry && last_entry->has_deopt_info()) {
+  if (!truncated && last_entry && last_entry->has_deopt_info()) {
     node->CollectDeoptInfo(last_entry);
   }
   if (update_stats) {
+    if (truncated) ++truncated_ticks_count_;
     node->IncrementSelfTicks();
     if (src_line != v8::CpuProfileNode::kNoLineNumberInfo) {
       node->IncrementLineTicks(src_line);
@@ -388,13 +401,16 @@ void ProfileTree::TraverseDepthFirst(Callback* callback) {
 using v8::tracing::TracedValue;
 
 CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
-                       bool record_samples)
+                       bool record_samples, unsigned max_nodes)
     : title_(title),
-      record_samples_(record_samples),
+      record_samples_(record_samples && max_nodes == 0),
       start_time_(base::TimeTicks::HighResolutionNow()),
-      top_down_(profiler->isolate()),
+      top_down_(profiler->isolate(), max_nodes),
       profiler_(profiler),
-      streaming_next_sample_(0) {
+      streaming_next_sample_(0),
+      continuous_(max_nodes != 0),
+      delta_start_time_(start_time_),
+      delta_truncated_ticks_base_(0) {
   auto value = TracedValue::Create();
   value->SetDouble("startTime",
                    (start_time_ - base::TimeTicks()).InMicroseconds());
@@ -404,9 +420,18 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
 
 void CpuProfile::AddPath(base::TimeTicks timestamp,
                          const std::vector<CodeEntry*>& path, int src_line,
-                         bool update_stats) {
+                         bool update_stats, base::TimeTicks processing_start) {
   ProfileNode* top_frame_node =
       top_down_.AddPathFromEnd(path, src_line, update_stats);
+  if (continuous_) {
+    // New nodes stay in the pending queue of the tree until the next delta.
+    if (update_stats) ++delta_ticks_[top_frame_node];
+    if (!processing_start.IsNull()) {
+      delta_processing_time_ +=
+          base::TimeTicks::HighResolutionNow() - processing_start;
+    }
+    return;
+  }
   if (record_samples_ && !timestamp.IsNull()) {
     timestamps_.Add(timestamp);
     samples_.Add(top_frame_node);
@@ -492,6 +517,24 @@ void CpuProfile::StreamPendingTraceEvents() {
                               "ProfileChunk", this, "data", std::move(value));
 }
 
+CpuProfileDelta* CpuProfile::TakeDelta() {
+  DCHECK(continuous_);
+  CpuProfileDelta* delta = new CpuProfileDelta();
+  delta->nodes_ = top_down_.TakePendingNodes();
+  delta->ticks_.assign(delta_ticks_.begin(), delta_ticks_.end());
+  delta_ticks_.clear();
+  unsigned truncated_ticks_count = top_down_.truncated_ticks_count();
+  delta->truncated_ticks_count_ =
+      truncated_ticks_count - delta_truncated_ticks_base_;
+  delta_truncated_ticks_base_ = truncated_ticks_count;
+  delta->start_time_ = delta_start_time_;
+  delta->end_time_ = base::TimeTicks::HighResolutionNow();
+  delta_start_time_ = delta->end_time_;
+  delta->processing_time_ = delta_processing_time_;
+  delta_processing_time_ = base::TimeDelta();
+  return delta;
+}
+
 void CpuProfile::FinishProfile() {
   end_time_ = base::TimeTicks::HighResolutionNow();
   StreamPendingTraceEvents();
@@ -563,7 +606,8 @@ CpuProfilesCollection::~CpuProfilesCollection() {
 
 
 bool CpuProfilesCollection::StartProfiling(const char* title,
-                                           bool record_samples) {
+                                           bool record_samples,
+                                           unsigned max_nodes) {
   current_profiles_semaphore_.Wait();
   if (current_profiles_.length() >= kMaxSimultaneousProfiles) {
     current_profiles_semaphore_.Signal();
@@ -577,7 +621,8 @@ bool CpuProfilesCollection::StartProfiling(const char* title,
       return true;
     }
   }
-  current_profiles_.Add(new CpuProfile(profiler_, title, record_samples));
+  current_profiles_.Add(
+      new CpuProfile(profiler_, title, record_samples, max_nodes));
   current_profiles_semaphore_.Signal();
   return true;
 }
@@ -602,6 +647,21 @@ CpuProfile* CpuProfilesCollection::StopProfiling(const char* title) {
 }
 
 
+CpuProfileDelta* CpuProfilesCollection::TakeProfileDelta(const char* title) {
+  CpuProfileDelta* delta = nullptr;
+  current_profiles_semaphore_.Wait();
+  for (int i = 0; i < current_profiles_.length(); ++i) {
+    CpuProfile* profile = current_profiles_[i];
+    if (profile->is_continuous() && strcmp(profile->title(), title) == 0) {
+      delta = profile->TakeDelta();
+      break;
+    }
+  }
+  current_profiles_semaphore_.Signal();
+  return delta;
+}
+
+
 bool CpuProfilesCollection::IsLastProfile(const char* title) {
   // Called from VM thread, and only it can mutate the list,
   // so no locking is needed here.
@@ -624,13 +684,14 @@ void CpuProfilesCollection::RemoveProfile(CpuProfile* profile) {
 
 void CpuProfilesCollection::AddPathToCurrentProfiles(
     base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
-    int src_line, bool update_stats) {
+    int src_line, bool update_stats, base::TimeTicks processing_start) {
   // As starting / stopping profiles is rare relatively to this
   // method, we don't bother minimizing the duration of lock holding,
   // e.g. copying contents of the list to a local vector.
   current_profiles_semaphore_.Wait();
   for (int i = 0; i < current_profiles_.length(); ++i) {
-    current_profiles_[i]->AddPath(timestamp, path, src_line, update_stats);
+    current_profiles_[i]->AddPath(timestamp, path, src_line, update_stats,
+                                  processing_start);
   }
   current_profiles_semaphore_.Signal();
 }
@@ -649,6 +710,7 @@ ProfileGenerator::ProfileGenerator(Isolate* isolate,
 }
 
 void ProfileGenerator::RecordTickSample(const TickSample& sample) {
+  base::TimeTicks processing_start = base::TimeTicks::HighResolutionNow();
   std::vector<CodeEntry*> entries;
   // Conservatively reserve space for stack frames + pc + function + vm-state.
   // There could in fact be more of them because of inlined entries.
@@ -747,7 +809,7 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
   }
 
   profiles_->AddPathToCurrentProfiles(sample.timestamp, entries, src_line,
-                                      sample.update_stats);
+                                      sample.update_stats, processing_start);
 }
 
 CodeEntry* ProfileGenerator::FindEntry(void* address) {
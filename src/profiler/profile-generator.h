@@ -6,6 +6,10 @@
 #define V8_PROFILER_PROFILE_GENERATOR_H_
 
 #include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "src/allocation.h"
 #include "src/base/hashmap.h"
 #include "src/log.h"
@@ -225,7 +229,10 @@ class ProfileNode {
 
 class ProfileTree {
  public:
-  explicit ProfileTree(Isolate* isolate);
+  // A non-zero {max_nodes} limits the number of nodes in the tree. Paths
+  // that would need more nodes are truncated to their longest prefix that is
+  // already in the tree.
+  explicit ProfileTree(Isolate* isolate, unsigned max_nodes = 0);
   ~ProfileTree();
 
   ProfileNode* AddPathFromEnd(
@@ -235,6 +242,9 @@ class ProfileTree {
   ProfileNode* root() const { return root_; }
   unsigned next_node_id() { return next_node_id_++; }
   unsigned GetFunctionId(const ProfileNode* node);
+  unsigned nodes_count() const { return next_node_id_ - 1; }
+  // Number of ticks that were attributed to a truncated path.
+  unsigned truncated_ticks_count() const { return truncated_ticks_count_; }
 
   void Print() {
     root_->Print(0);
@@ -258,6 +268,8 @@ class ProfileTree {
   unsigned next_node_id_;
   ProfileNode* root_;
   Isolate* isolate_;
+  unsigned max_nodes_;
+  unsigned truncated_ticks_count_;
 
   unsigned next_function_id_;
   base::CustomMatcherHashMap function_ids_;
@@ -266,16 +278,54 @@ class ProfileTree {
 };
 
 
-class CpuProfile {
+// What a continuous profile collected between two calls to
+// CpuProfile::TakeDelta().
+class CpuProfileDelta {
  public:
-  CpuProfile(CpuProfiler* profiler, const char* title, bool record_samples);
+  typedef std::pair<const ProfileNode*, unsigned> NodeTicks;
+
+  // Nodes added to the tree, in the order of their ids.
+  const std::vector<const ProfileNode*>& nodes() const { return nodes_; }
+  // Ticks attributed to each node that was hit.
+  const std::vector<NodeTicks>& ticks() const { return ticks_; }
+  unsigned truncated_ticks_count() const { return truncated_ticks_count_; }
+  base::TimeTicks start_time() const { return start_time_; }
+  base::TimeTicks end_time() const { return end_time_; }
+  base::TimeDelta processing_time() const { return processing_time_; }
+
+ private:
+  friend class CpuProfile;
 
-  // Add pc -> ... -> main() call path to the profile.
+  std::vector<const ProfileNode*> nodes_;
+  std::vector<NodeTicks> ticks_;
+  unsigned truncated_ticks_count_;
+  base::TimeTicks start_time_;
+  base::TimeTicks end_time_;
+  base::TimeDelta processing_time_;
+};
+
+class CpuProfile {
+ public:
+  // A non-zero {max_nodes} makes the profile continuous: its tree is limited
+  // to {max_nodes} nodes and, instead of recording samples or streaming trace
+  // events, it aggregates ticks per node until they are taken with
+  // TakeDelta(). Its memory use is bounded however long it is collected.
+  CpuProfile(CpuProfiler* profiler, const char* title, bool record_samples,
+             unsigned max_nodes = 0);
+
+  // Add pc -> ... -> main() call path to the profile. {processing_start} is
+  // the time the profiler thread started processing the sample, if known.
   void AddPath(base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
-               int src_line, bool update_stats);
+               int src_line, bool update_stats,
+               base::TimeTicks processing_start = base::TimeTicks());
   void FinishProfile();
 
+  // Returns what a continuous profile collected since it was started or since
+  // the previous call. The caller takes ownership of the delta.
+  CpuProfileDelta* TakeDelta();
+
   const char* title() const { return title_; }
+  bool is_continuous() const { return continuous_; }
   const ProfileTree* top_down() const { return &top_down_; }
 
   int samples_count() const { return samples_.length(); }
@@ -305,6 +355,13 @@ class CpuProfile {
   CpuProfiler* const profiler_;
   int streaming_next_sample_;
 
+  // Continuous profiles only, all reset by TakeDelta().
+  bool continuous_;
+  std::unordered_map<const ProfileNode*, unsigned> delta_ticks_;
+  base::TimeTicks delta_start_time_;
+  base::TimeDelta delta_processing_time_;
+  unsigned delta_truncated_ticks_base_;
+
   DISALLOW_COPY_AND_ASSIGN(CpuProfile);
 };
 
@@ -338,17 +395,21 @@ class CpuProfilesCollection {
   ~CpuProfilesCollection();
 
   void set_cpu_profiler(CpuProfiler* profiler) { profiler_ = profiler; }
-  bool StartProfiling(const char* title, bool record_samples);
+  bool StartProfiling(const char* title, bool record_samples,
+                      unsigned max_nodes = 0);
   CpuProfile* StopProfiling(const char* title);
+  // Returns nullptr unless a continuous profile {title} is being collected.
+  CpuProfileDelta* TakeProfileDelta(const char* title);
   List<CpuProfile*>* profiles() { return &finished_profiles_; }
   const char* GetName(Name* name) { return resource_names_.GetName(name); }
   bool IsLastProfile(const char* title);
   void RemoveProfile(CpuProfile* profile);
 
   // Called from profile generator thread.
-  void AddPathToCurrentProfiles(base::TimeTicks timestamp,
-                                const std::vector<CodeEntry*>& path,
-                                int src_line, bool update_stats);
+  void AddPathToCurrentProfiles(
+      base::TimeTicks timestamp, const std::vector<CodeEntry*>& path,
+      int src_line, bool update_stats,
+      base::TimeTicks processing_start = base::TimeTicks());
 
   // Limits the number of profiles that can be simultaneously collected.
   static const int kMaxSimultaneousProfiles = 100;
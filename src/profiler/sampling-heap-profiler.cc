@@ -10,8 +10,10 @@
 #include "src/base/ieee754.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/frames-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/isolate.h"
+#include "src/profiler/heap-profiler.h"
 #include "src/profiler/strings-storage.h"
 
 namespace v8 {
@@ -48,6 +50,11 @@ v8::AllocationProfile::Allocation SamplingHeapProfiler::ScaleSample(
   return {size, static_cast<unsigned int>(count * scale + 0.5)};
 }
 
+size_t SamplingHeapProfiler::ScaleSize(size_t size) {
+  double scale = 1.0 / (1.0 - std::exp(-static_cast<double>(size) / rate_));
+  return static_cast<size_t>(size * scale + 0.5);
+}
+
 SamplingHeapProfiler::SamplingHeapProfiler(
     Heap* heap, StringsStorage* names, uint64_t rate, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags)
@@ -73,6 +80,12 @@ SamplingHeapProfiler::SamplingHeapProfiler(
       space->AddAllocationObserver(other_spaces_observer_.get());
     }
   }
+  if (tracks_retention()) {
+    GCType gc_types =
+        static_cast<GCType>(kGCTypeScavenge | kGCTypeMarkSweepCompact);
+    heap->AddGCPrologueCallback(OnGCPrologue, gc_types);
+    heap->AddGCEpilogueCallback(OnGCEpilogue, gc_types);
+  }
 }
 
 
@@ -84,6 +97,10 @@ SamplingHeapProfiler::~SamplingHeapProfiler() {
       space->RemoveAllocationObserver(other_spaces_observer_.get());
     }
   }
+  if (tracks_retention()) {
+    heap_->RemoveGCPrologueCallback(OnGCPrologue);
+    heap_->RemoveGCEpilogueCallback(OnGCEpilogue);
+  }
 
   for (auto sample : samples_) {
     delete sample;
@@ -110,6 +127,15 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
   Sample* sample = new Sample(size, node, loc, this);
+  if (tracks_retention()) {
+    size_t scaled_size = ScaleSize(size);
+    node->retention_.allocated_size += scaled_size;
+    if (heap()->InNewSpace(heap_object)) {
+      sample->young = true;
+    } else {
+      node->retention_.pretenured_size += scaled_size;
+    }
+  }
   samples_.insert(sample);
   sample->global.SetWeak(sample, OnWeakCallback, WeakCallbackType::kParameter);
   sample->global.MarkIndependent();
@@ -123,8 +149,11 @@ void SamplingHeapProfiler::OnWeakCallback(
   node->allocations_[sample->size]--;
   if (node->allocations_[sample->size] == 0) {
     node->allocations_.erase(sample->size);
+    // Nodes carry their allocation history when tracking retention, so
+    // they are kept until the profiler is stopped.
     while (node->allocations_.empty() && node->children_.empty() &&
-           node->parent_ && !node->parent_->pinned_) {
+           node->parent_ && !node->parent_->pinned_ &&
+           !sample->profiler->tracks_retention()) {
       AllocationNode* parent = node->parent_;
       AllocationNode::FunctionId id = AllocationNode::function_id(
           node->script_id_, node->script_position_, node->name_);
@@ -137,6 +166,65 @@ void SamplingHeapProfiler::OnWeakCallback(
   delete sample;
 }
 
+// static
+void SamplingHeapProfiler::OnGCPrologue(v8::Isolate* isolate, GCType type,
+                                        GCCallbackFlags flags) {
+  SamplingHeapProfiler* profiler = reinterpret_cast<Isolate*>(isolate)
+                                       ->heap_profiler()
+                                       ->sampling_heap_profiler();
+  if (profiler != nullptr) profiler->RecordAllocationSites();
+}
+
+// static
+void SamplingHeapProfiler::OnGCEpilogue(v8::Isolate* isolate, GCType type,
+                                        GCCallbackFlags flags) {
+  SamplingHeapProfiler* profiler = reinterpret_cast<Isolate*>(isolate)
+                                       ->heap_profiler()
+                                       ->sampling_heap_profiler();
+  if (profiler != nullptr) profiler->RecordSurvivors();
+}
+
+HeapObject* SamplingHeapProfiler::SampledObject(Sample* sample) {
+  HandleScope scope(isolate_);
+  Local<v8::Value> local =
+      sample->global.Get(reinterpret_cast<v8::Isolate*>(isolate_));
+  return HeapObject::cast(*v8::Utils::OpenHandle(*local));
+}
+
+void SamplingHeapProfiler::RecordAllocationSites() {
+  DisallowHeapAllocation no_allocation;
+  for (Sample* sample : samples_) {
+    // Only samples that have not seen a garbage collection yet still have
+    // their allocation memento behind them.
+    if (!sample->young || sample->survived || sample->global.IsEmpty()) {
+      continue;
+    }
+    HeapObject* object = SampledObject(sample);
+    if (!object->IsJSObject()) continue;
+    if (heap()->FindAllocationMemento<Heap::kForRuntime>(object) != nullptr) {
+      sample->owner->retention_.allocation_site_size +=
+          ScaleSize(sample->size);
+    }
+  }
+}
+
+void SamplingHeapProfiler::RecordSurvivors() {
+  DisallowHeapAllocation no_allocation;
+  for (Sample* sample : samples_) {
+    if (!sample->young || sample->global.IsEmpty()) continue;
+    v8::AllocationProfile::Retention& retention = sample->owner->retention_;
+    size_t scaled_size = ScaleSize(sample->size);
+    if (!sample->survived) {
+      sample->survived = true;
+      retention.survived_size += scaled_size;
+    }
+    if (!heap()->InNewSpace(SampledObject(sample))) {
+      sample->young = false;
+      retention.promoted_size += scaled_size;
+    }
+  }
+}
+
 SamplingHeapProfiler::AllocationNode*
 SamplingHeapProfiler::AllocationNode::FindOrAddChildNode(const char* name,
                                                          int script_id,
@@ -243,7 +331,8 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
       {ToApiHandle<v8::String>(
            isolate_->factory()->InternalizeUtf8String(node->name_)),
        script_name, node->script_id_, node->script_position_, line, column,
-       std::vector<v8::AllocationProfile::Node*>(), allocations}));
+       std::vector<v8::AllocationProfile::Node*>(), allocations,
+       node->retention_}));
   v8::AllocationProfile::Node* current = &profile->nodes().back();
   // The children map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
@@ -59,12 +59,19 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
-          profiler(profiler_) {}
+          profiler(profiler_),
+          young(false),
+          survived(false) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
+    // Whether the object is still in the young generation, and whether it
+    // has survived a garbage collection. Only maintained when tracking
+    // retention.
+    bool young;
+    bool survived;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -78,7 +85,8 @@ class SamplingHeapProfiler {
           script_id_(script_id),
           script_position_(start_position),
           name_(name),
-          pinned_(false) {}
+          pinned_(false),
+          retention_() {}
     ~AllocationNode() {
       for (auto child : children_) {
         delete child.second;
@@ -113,6 +121,7 @@ class SamplingHeapProfiler {
     const int script_position_;
     const char* const name_;
     bool pinned_;
+    v8::AllocationProfile::Retention retention_;
 
     friend class SamplingHeapProfiler;
 
@@ -126,6 +135,20 @@ class SamplingHeapProfiler {
 
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
 
+  // Retention tracking. Before a garbage collection the allocation mementos
+  // of the new young samples are still in place, afterwards the samples that
+  // survived or got promoted are accounted to their nodes.
+  bool tracks_retention() const {
+    return (flags_ & v8::HeapProfiler::kSamplingTrackRetention) != 0;
+  }
+  static void OnGCPrologue(v8::Isolate* isolate, GCType type,
+                           GCCallbackFlags flags);
+  static void OnGCEpilogue(v8::Isolate* isolate, GCType type,
+                           GCCallbackFlags flags);
+  void RecordAllocationSites();
+  void RecordSurvivors();
+  HeapObject* SampledObject(Sample* sample);
+
   // Methods that construct v8::AllocationProfile.
 
   // Translates the provided AllocationNode *node* returning an equivalent
@@ -138,6 +161,8 @@ class SamplingHeapProfiler {
       const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count);
+  // The estimated number of bytes allocated per sample of |size| bytes.
+  size_t ScaleSize(size_t size);
   AllocationNode* AddStack();
 
   Isolate* const isolate_;
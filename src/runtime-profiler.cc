@@ -15,6 +15,7 @@
 #include "src/full-codegen/full-codegen.h"
 #include "src/global-handles.h"
 #include "src/interpreter/interpreter.h"
+#include "src/optimization-profile.h"
 
 namespace v8 {
 namespace internal {
@@ -57,11 +58,13 @@ static const int kMaxSizeEarlyOpt =
 static const int kMaxSizeEarlyOptIgnition =
     5 * interpreter::Interpreter::kCodeSizeMultiplier;
 
-#define OPTIMIZATION_REASON_LIST(V)                            \
-  V(DoNotOptimize, "do not optimize")                          \
-  V(HotAndStable, "hot and stable")                            \
-  V(HotEnoughForBaseline, "hot enough for baseline")           \
-  V(HotWithoutMuchTypeInfo, "not much type info but very hot") \
+#define OPTIMIZATION_REASON_LIST(V)                             \
+  V(DoNotOptimize, "do not optimize")                           \
+  V(HotAndStable, "hot and stable")                             \
+  V(HotEnoughForBaseline, "hot enough for baseline")            \
+  V(HotWithoutMuchTypeInfo, "not much type info but very hot")  \
+  V(HotInProfile, "hot in optimization profile")                \
+  V(HotButDeoptimizedTooOften, "hot but deoptimized too often") \
   V(SmallFunction, "small function")
 
 enum class OptimizationReason : uint8_t {
@@ -90,6 +93,12 @@ RuntimeProfiler::RuntimeProfiler(Isolate* isolate)
       any_ic_changed_(false) {
 }
 
+RuntimeProfiler::~RuntimeProfiler() {}
+
+void RuntimeProfiler::SetOptimizationProfile(OptimizationProfile* profile) {
+  optimization_profile_.reset(profile);
+}
+
 static void GetICCounts(JSFunction* function, int* ic_with_type_info_count,
                         int* ic_generic_count, int* ic_total_count,
                         int* type_info_percentage, int* generic_percentage) {
@@ -152,6 +161,22 @@ void RuntimeProfiler::Optimize(JSFunction* function,
   function->AttemptConcurrentOptimization();
 }
 
+bool RuntimeProfiler::IsHotInProfile(JSFunction* function) {
+  // Only the first optimization is brought forward. After a deopt the
+  // function has to become hot again in this process.
+  if (!optimization_profile_ || function->shared()->opt_count() != 0 ||
+      !optimization_profile_->IsHot(function->shared())) {
+    return false;
+  }
+  // Don't wait for ticks if the function was hot in the profiled run, as
+  // long as its feedback has already been collected.
+  int typeinfo, generic, total, type_percentage, generic_percentage;
+  GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
+              &generic_percentage);
+  return type_percentage >= FLAG_type_info_threshold &&
+         generic_percentage <= FLAG_generic_ic_threshold;
+}
+
 void RuntimeProfiler::Baseline(JSFunction* function,
                                OptimizationReason reason) {
   DCHECK_NE(reason, OptimizationReason::kDoNotOptimize);
@@ -262,6 +287,11 @@ void RuntimeProfiler::MaybeOptimizeFullCodegen(JSFunction* function,
 
   int ticks = shared_code->profiler_ticks();
 
+  if (IsHotInProfile(function)) {
+    Optimize(function, OptimizationReason::kHotInProfile);
+    return;
+  }
+
   if (ticks >= kProfilerTicksBeforeOptimization) {
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
@@ -349,6 +379,19 @@ void RuntimeProfiler::MaybeOptimizeIgnition(JSFunction* function,
         shared->TryReenableOptimization();
       }
     }
+    if (FLAG_turbo_baseline && shared->optimization_disabled() &&
+        shared->disable_optimization_reason() == kDeoptimizedTooManyTimes &&
+        !frame->is_optimized() && !function->IsMarkedForOptimization() &&
+        ticks >= kProfilerTicksBeforeOptimization) {
+      // Meanwhile compile it without speculation. This is done on the main
+      // thread, since the function won't be optimized any further.
+      TraceRecompile(
+          function,
+          OptimizationReasonToString(
+              OptimizationReason::kHotButDeoptimizedTooOften),
+          "non-speculative");
+      function->MarkForOptimization();
+    }
     return;
   }
 
@@ -394,6 +437,8 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
   SharedFunctionInfo* shared = function->shared();
   int ticks = shared->profiler_ticks();
 
+  if (IsHotInProfile(function)) return OptimizationReason::kHotInProfile;
+
   if (ticks >= kProfilerTicksBeforeOptimization) {
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
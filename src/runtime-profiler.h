@@ -5,6 +5,8 @@
 #ifndef V8_RUNTIME_PROFILER_H_
 #define V8_RUNTIME_PROFILER_H_
 
+#include <memory>
+
 #include "src/allocation.h"
 
 namespace v8 {
@@ -13,14 +15,20 @@ namespace internal {
 class Isolate;
 class JavaScriptFrame;
 class JSFunction;
+class OptimizationProfile;
 enum class OptimizationReason : uint8_t;
 
 class RuntimeProfiler {
  public:
   explicit RuntimeProfiler(Isolate* isolate);
+  ~RuntimeProfiler();
 
   void MarkCandidatesForOptimization();
 
+  // Functions that were hot according to {profile} are optimized as soon as
+  // they are seen on the stack, rather than after accumulating ticks.
+  void SetOptimizationProfile(OptimizationProfile* profile);
+
   void NotifyICChanged() { any_ic_changed_ = true; }
 
   void AttemptOnStackReplacement(JavaScriptFrame* frame,
@@ -38,9 +46,13 @@ class RuntimeProfiler {
                                             JavaScriptFrame* frame);
   void Optimize(JSFunction* function, OptimizationReason reason);
   void Baseline(JSFunction* function, OptimizationReason reason);
+  // Whether {function} was hot in the installed optimization profile and has
+  // collected enough type feedback to be optimized right away.
+  bool IsHotInProfile(JSFunction* function);
 
   Isolate* isolate_;
   bool any_ic_changed_;
+  std::unique_ptr<OptimizationProfile> optimization_profile_;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/arguments.h"
 #include "src/code-stubs.h"
 #include "src/conversions-inl.h"
@@ -72,6 +75,9 @@ RUNTIME_FUNCTION(Runtime_SpecialArrayFunctions) {
   InstallBuiltin(isolate, holder, "splice", Builtins::kArraySplice);
   InstallBuiltin(isolate, holder, "includes", Builtins::kArrayIncludes, 2);
   InstallBuiltin(isolate, holder, "indexOf", Builtins::kArrayIndexOf, 2);
+  InstallBuiltin(isolate, holder, "forEach", Builtins::kArrayForEach, 2);
+  InstallBuiltin(isolate, holder, "some", Builtins::kArraySome, 2);
+  InstallBuiltin(isolate, holder, "every", Builtins::kArrayEvery, 2);
   InstallBuiltin(isolate, holder, "keys", Builtins::kArrayPrototypeKeys, 0,
                  kArrayKeys);
   InstallBuiltin(isolate, holder, "values", Builtins::kArrayPrototypeValues, 0,
@@ -131,6 +137,128 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+namespace {
+
+// Compares two flat strings by their UTF-16 code units without allocating.
+bool FlatStringLessThan(String* x, String* y) {
+  String::FlatContent x_content = x->GetFlatContent();
+  String::FlatContent y_content = y->GetFlatContent();
+  int prefix_length = Min(x->length(), y->length());
+  int r;
+  if (x_content.IsOneByte()) {
+    if (y_content.IsOneByte()) {
+      r = CompareChars(x_content.ToOneByteVector().start(),
+                       y_content.ToOneByteVector().start(), prefix_length);
+    } else {
+      r = CompareChars(x_content.ToOneByteVector().start(),
+                       y_content.ToUC16Vector().start(), prefix_length);
+    }
+  } else {
+    if (y_content.IsOneByte()) {
+      r = CompareChars(x_content.ToUC16Vector().start(),
+                       y_content.ToOneByteVector().start(), prefix_length);
+    } else {
+      r = CompareChars(x_content.ToUC16Vector().start(),
+                       y_content.ToUC16Vector().start(), prefix_length);
+    }
+  }
+  if (r != 0) return r < 0;
+  return x->length() < y->length();
+}
+
+}  // namespace
+
+
+// Sorts the first {length} elements of a fast JSArray with the default
+// comparator if they are all Smis or all strings, apart from undefined values
+// and holes. The sort is stable and never calls back into JavaScript.
+// Returns false if the array is not supported, in which case it is unchanged.
+RUNTIME_FUNCTION(Runtime_ArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, object, 0);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(length_object, 1);
+  // The length comes from ToLength, which is not limited to array lengths.
+  uint32_t length = 0;
+  if (!object->IsJSArray() || !length_object->ToArrayLength(&length)) {
+    return isolate->heap()->false_value();
+  }
+  Handle<JSArray> array = Handle<JSArray>::cast(object);
+  uint32_t array_length = 0;
+  if (!array->HasFastSmiOrObjectElements() ||
+      !array->length()->ToArrayLength(&array_length) ||
+      array_length != length ||
+      !JSObject::PrototypeHasNoElements(isolate, *array)) {
+    return isolate->heap()->false_value();
+  }
+  if (length < 2) return isolate->heap()->true_value();
+  JSObject::EnsureWritableFastElements(array);
+  Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate);
+  DCHECK_LE(length, static_cast<uint32_t>(elements->length()));
+
+  // Classify the elements. Undefined values are sorted after all other
+  // values and holes after those.
+  bool has_smis = false;
+  bool has_strings = false;
+  for (uint32_t i = 0; i < length; i++) {
+    Object* element = elements->get(i);
+    if (element->IsSmi()) {
+      has_smis = true;
+    } else if (element->IsString()) {
+      has_strings = true;
+    } else if (!element->IsUndefined(isolate) &&
+               !element->IsTheHole(isolate)) {
+      return isolate->heap()->false_value();
+    }
+  }
+  if (has_smis && has_strings) return isolate->heap()->false_value();
+
+  // Flatten the strings up front so that comparisons do not allocate.
+  if (has_strings) {
+    for (uint32_t i = 0; i < length; i++) {
+      if (!elements->get(i)->IsString()) continue;
+      Handle<String> string(String::cast(elements->get(i)), isolate);
+      if (string->IsFlat()) continue;
+      elements->set(i, *String::Flatten(string));
+    }
+  }
+
+  DisallowHeapAllocation no_gc;
+  std::vector<Object*> values;
+  values.reserve(length);
+  uint32_t undefined_count = 0;
+  for (uint32_t i = 0; i < length; i++) {
+    Object* element = elements->get(i);
+    if (element->IsUndefined(isolate)) {
+      undefined_count++;
+    } else if (!element->IsTheHole(isolate)) {
+      values.push_back(element);
+    }
+  }
+
+  if (has_strings) {
+    std::stable_sort(values.begin(), values.end(), [](Object* x, Object* y) {
+      return FlatStringLessThan(String::cast(x), String::cast(y));
+    });
+  } else {
+    std::stable_sort(values.begin(), values.end(), [](Object* x, Object* y) {
+      return Smi::LexicographicCompare(Smi::cast(x), Smi::cast(y)) == LESS;
+    });
+  }
+
+  WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+  uint32_t k = 0;
+  for (Object* value : values) elements->set(k++, value, mode);
+  for (uint32_t i = 0; i < undefined_count; i++) {
+    elements->set(k++, isolate->heap()->undefined_value(), SKIP_WRITE_BARRIER);
+  }
+  while (k < length) {
+    elements->set_the_hole(isolate, k++);
+  }
+  return isolate->heap()->true_value();
+}
+
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
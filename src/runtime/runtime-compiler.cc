@@ -321,18 +321,52 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
                          : DetermineEntryAndDisarmOSRForBaseline(frame);
   DCHECK(!ast_id.IsNone());
 
+  // OSR from bytecode can be compiled on the background thread. The back edges
+  // stay disarmed until the job has been finalized, meanwhile the loop keeps
+  // running in the interpreter. OSR jobs are tracked per entry point by the
+  // dispatcher and don't touch the code of the function, so they don't
+  // interfere with a regular concurrent job for the same function. Function
+  // context specialized code is never cached in the optimized code map, which
+  // is the only way for the back edges to pick up code compiled concurrently.
+  bool try_concurrent = FLAG_concurrent_osr && frame->is_interpreted() &&
+                        !FLAG_function_context_specialization &&
+                        isolate->concurrent_recompilation_enabled();
+  Compiler::ConcurrencyMode mode =
+      try_concurrent ? Compiler::CONCURRENT : Compiler::NOT_CONCURRENT;
+
   MaybeHandle<Code> maybe_result;
-  if (IsSuitableForOnStackReplacement(isolate, function)) {
+  if (try_concurrent &&
+      isolate->optimizing_compile_dispatcher()->HasPendingOsrJob(function,
+                                                                 ast_id)) {
+    // A job for this entry is already pending, don't queue another one.
+    if (FLAG_trace_osr) {
+      PrintF("[OSR - Deferred: ");
+      function->PrintName();
+      PrintF(" at AST id %d is already in the optimization queue]\n",
+             ast_id.ToInt());
+    }
+    return NULL;
+  } else if (IsSuitableForOnStackReplacement(isolate, function)) {
     if (FLAG_trace_osr) {
       PrintF("[OSR - Compiling: ");
       function->PrintName();
       PrintF(" at AST id %d]\n", ast_id.ToInt());
     }
-    maybe_result = Compiler::GetOptimizedCodeForOSR(function, ast_id, frame);
+    maybe_result =
+        Compiler::GetOptimizedCodeForOSR(function, ast_id, frame, mode);
   }
 
   // Check whether we ended up with usable optimized code.
   Handle<Code> result;
+  if (maybe_result.ToHandle(&result) &&
+      *result == *isolate->builtins()->InOptimizationQueue()) {
+    if (FLAG_trace_osr) {
+      PrintF("[OSR - Queued: ");
+      function->PrintName();
+      PrintF(" at AST id %d for concurrent optimization]\n", ast_id.ToInt());
+    }
+    return NULL;
+  }
   if (maybe_result.ToHandle(&result) &&
       result->kind() == Code::OPTIMIZED_FUNCTION) {
     DeoptimizationInputData* data =
@@ -376,7 +410,8 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
     PrintF(" at AST id %d]\n", ast_id.ToInt());
   }
 
-  if (!function->IsOptimized()) {
+  // Leave the marker of a pending regular concurrent job in place.
+  if (!function->IsOptimized() && !function->IsInOptimizationQueue()) {
     function->ReplaceCode(function->shared()->code());
   }
   return NULL;
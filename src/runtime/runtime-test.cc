@@ -299,6 +299,15 @@ RUNTIME_FUNCTION(Runtime_GetOptimizationCount) {
   return Smi::FromInt(function->shared()->opt_count());
 }
 
+// Unlike GetOptimizationStatus this also sees OSR code, which is entered
+// without being installed on the function.
+RUNTIME_FUNCTION(Runtime_RunningInOptimizedCode) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 0);
+  JavaScriptFrameIterator it(isolate);
+  return isolate->heap()->ToBoolean(!it.done() && it.frame()->is_optimized());
+}
+
 static void ReturnThis(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(args.This());
 }
@@ -4,7 +4,11 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <memory>
+
 #include "src/arguments.h"
+#include "src/elements.h"
 #include "src/factory.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
@@ -296,15 +300,11 @@ RUNTIME_FUNCTION(Runtime_TypedArrayGetBuffer) {
 // Return codes for Runtime_TypedArraySetFastCases.
 // Should be synchronized with typedarray.js natives.
 enum TypedArraySetResultCodes {
-  // Set from typed array of the same type.
+  // Set from a typed array of any type.
   // This is processed by TypedArraySetFastCases
-  TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE = 0,
-  // Set from typed array of the different type, overlapping in memory.
-  TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING = 1,
-  // Set from typed array of the different type, non-overlapping.
-  TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING = 2,
+  TYPED_ARRAY_SET_TYPED_ARRAY = 0,
   // Set from non-typed array.
-  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 3
+  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 1
 };
 
 
@@ -329,7 +329,6 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   CHECK(TryNumberToSize(*offset_obj, &offset));
   size_t target_length = target->length_value();
   size_t source_length = source->length_value();
-  size_t target_byte_length = NumberToSize(target->byte_length());
   size_t source_byte_length = NumberToSize(source->byte_length());
   if (offset > target_length || offset + source_length > target_length ||
       offset + source_length < offset) {  // overflow
@@ -337,34 +336,172 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
         isolate, NewRangeError(MessageTemplate::kTypedArraySetSourceTooLarge));
   }
 
-  size_t target_offset = NumberToSize(target->byte_offset());
-  size_t source_offset = NumberToSize(source->byte_offset());
-  uint8_t* target_base =
-      static_cast<uint8_t*>(target->GetBuffer()->backing_store()) +
-      target_offset;
-  uint8_t* source_base =
-      static_cast<uint8_t*>(source->GetBuffer()->backing_store()) +
-      source_offset;
-
   // Typed arrays of the same type: use memmove.
   if (target->type() == source->type()) {
+    size_t target_offset = NumberToSize(target->byte_offset());
+    size_t source_offset = NumberToSize(source->byte_offset());
+    uint8_t* target_base =
+        static_cast<uint8_t*>(target->GetBuffer()->backing_store()) +
+        target_offset;
+    uint8_t* source_base =
+        static_cast<uint8_t*>(source->GetBuffer()->backing_store()) +
+        source_offset;
     memmove(target_base + offset * target->element_size(), source_base,
             source_byte_length);
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE);
+    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY);
+  }
+
+  // Typed arrays of different types, possibly over the same buffer, are
+  // converted element-wise by a kernel specialized for the pair of types.
+  target->GetElementsAccessor()->CopyTypedArrayElements(
+      source, target, static_cast<uint32_t>(offset));
+  return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY);
+}
+
+
+RUNTIME_FUNCTION(Runtime_TypedArrayFill) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(4, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(value, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, start, Uint32, args[2]);
+  CONVERT_NUMBER_CHECKED(uint32_t, end, Uint32, args[3]);
+  // The arguments have been converted by the caller, which may have run
+  // user code that neutered the buffer.
+  end = Min(end, array->length_value());
+  if (start < end) {
+    array->GetElementsAccessor()->Fill(array, value, start, end);
+  }
+  return *array;
+}
+
+
+RUNTIME_FUNCTION(Runtime_TypedArrayIndexOf) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, start, Uint32, args[2]);
+  uint32_t length = array->length_value();
+  if (start >= length) return Smi::FromInt(-1);
+  Maybe<int64_t> result = array->GetElementsAccessor()->IndexOfValue(
+      isolate, array, value, start, length);
+  return *isolate->factory()->NewNumberFromInt64(result.FromJust());
+}
+
+
+RUNTIME_FUNCTION(Runtime_TypedArrayLastIndexOf) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, start, Uint32, args[2]);
+  uint32_t length = array->length_value();
+  if (length == 0) return Smi::FromInt(-1);
+  start = Min(start, length - 1);
+  Maybe<int64_t> result = array->GetElementsAccessor()->LastIndexOfValue(
+      isolate, array, value, start);
+  return *isolate->factory()->NewNumberFromInt64(result.FromJust());
+}
+
+
+RUNTIME_FUNCTION(Runtime_TypedArrayCopyWithin) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(4, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  CONVERT_NUMBER_CHECKED(uint32_t, to, Uint32, args[1]);
+  CONVERT_NUMBER_CHECKED(uint32_t, from, Uint32, args[2]);
+  CONVERT_NUMBER_CHECKED(uint32_t, count, Uint32, args[3]);
+  uint32_t length = array->length_value();
+  if (count == 0 || to >= length || from >= length) return *array;
+  count = Min(count, Min(length - to, length - from));
+  size_t element_size = array->element_size();
+  uint8_t* data = static_cast<uint8_t*>(
+      FixedTypedArrayBase::cast(array->elements())->DataPtr());
+  memmove(data + to * element_size, data + from * element_size,
+          count * element_size);
+  return *array;
+}
+
+
+namespace {
+
+// Orders -0 before +0 and NaN after all other values, which is the order
+// TypedArray.prototype.sort without a comparator requires.
+template <typename T>
+bool CompareNumbers(T x, T y) {
+  if (x < y) return true;
+  if (x > y) return false;
+  if (x == 0 && y == 0) return std::signbit(x) && !std::signbit(y);
+  return !std::isnan(x) && std::isnan(y);
+}
+
+template <typename T>
+void SortTypedArrayData(T* data, uint32_t length) {
+  std::sort(data, data + length, CompareNumbers<T>);
+}
+
+// Elements of one byte take only 256 distinct values, so a counting sort
+// does a single pass over the data.
+template <typename T>
+void CountingSortTypedArrayData(T* data, uint32_t length) {
+  const int kOffset = -std::numeric_limits<T>::min();
+  uint32_t counts[256] = {0};
+  for (uint32_t i = 0; i < length; i++) counts[data[i] + kOffset]++;
+  uint32_t k = 0;
+  for (int value = 0; value < 256; value++) {
+    for (uint32_t n = counts[value]; n > 0; n--) {
+      data[k++] = static_cast<T>(value - kOffset);
+    }
   }
+}
 
-  // Typed arrays of different types over the same backing store
-  if ((source_base <= target_base &&
-       source_base + source_byte_length > target_base) ||
-      (target_base <= source_base &&
-       target_base + target_byte_length > source_base)) {
-    // We do not support overlapping ArrayBuffers
-    DCHECK(target->GetBuffer()->backing_store() ==
-           source->GetBuffer()->backing_store());
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING);
-  } else {  // Non-overlapping typed arrays
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
+template <>
+void SortTypedArrayData(int8_t* data, uint32_t length) {
+  CountingSortTypedArrayData(data, length);
+}
+
+template <>
+void SortTypedArrayData(uint8_t* data, uint32_t length) {
+  CountingSortTypedArrayData(data, length);
+}
+
+// Other threads may write to a shared buffer while it is sorted, which
+// std::sort does not tolerate, so the data is sorted in a private copy.
+template <typename T>
+void SortSharedTypedArrayData(T* data, uint32_t length) {
+  std::unique_ptr<T[]> copy(new T[length]);
+  memcpy(copy.get(), data, length * sizeof(T));
+  SortTypedArrayData(copy.get(), length);
+  memcpy(data, copy.get(), length * sizeof(T));
+}
+
+}  // namespace
+
+
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  uint32_t length = array->length_value();
+  if (length < 2) return *array;
+
+  DisallowHeapAllocation no_gc;
+  bool is_shared = JSArrayBuffer::cast(array->buffer())->is_shared();
+  void* data = FixedTypedArrayBase::cast(array->elements())->DataPtr();
+  switch (array->type()) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                        \
+  case kExternal##Type##Array:                                                 \
+    if (is_shared) {                                                           \
+      SortSharedTypedArrayData(static_cast<ctype*>(data), length);             \
+    } else {                                                                   \
+      SortTypedArrayData(static_cast<ctype*>(data), length);                   \
+    }                                                                          \
+    break;
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
   }
+  return *array;
 }
 
 
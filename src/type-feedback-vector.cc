@@ -176,6 +176,33 @@ FeedbackVectorSlotKind TypeFeedbackVector::GetKind(
   return metadata()->GetKind(slot);
 }
 
+InlineCacheState TypeFeedbackVector::GetICState(FeedbackVectorSlot slot) {
+  switch (GetKind(slot)) {
+    case FeedbackVectorSlotKind::LOAD_IC:
+      return LoadICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::LOAD_GLOBAL_IC:
+      return LoadGlobalICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::KEYED_LOAD_IC:
+      return KeyedLoadICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::CALL_IC:
+      return CallICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::STORE_IC:
+      return StoreICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::KEYED_STORE_IC:
+      return KeyedStoreICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::INTERPRETER_BINARYOP_IC:
+      return BinaryOpICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::INTERPRETER_COMPARE_IC:
+      return CompareICNexus(this, slot).StateFromFeedback();
+    case FeedbackVectorSlotKind::GENERAL:
+    case FeedbackVectorSlotKind::INVALID:
+    case FeedbackVectorSlotKind::KINDS_NUMBER:
+      break;
+  }
+  UNREACHABLE();
+  return UNINITIALIZED;
+}
+
 // static
 Handle<TypeFeedbackVector> TypeFeedbackVector::New(
     Isolate* isolate, Handle<TypeFeedbackMetadata> metadata) {
@@ -240,6 +240,10 @@ class TypeFeedbackVector : public FixedArray {
   // Returns slot kind for given slot.
   FeedbackVectorSlotKind GetKind(FeedbackVectorSlot slot) const;
 
+  // Returns the inline cache state of the IC in {slot}, which must not be a
+  // GENERAL slot.
+  InlineCacheState GetICState(FeedbackVectorSlot slot);
+
   static Handle<TypeFeedbackVector> New(Isolate* isolate,
                                         Handle<TypeFeedbackMetadata> metadata);
 
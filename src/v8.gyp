@@ -483,6 +483,7 @@
         'builtins/builtins-boolean.cc',
         'builtins/builtins-call.cc',
         'builtins/builtins-callsite.cc',
+        'builtins/builtins-collections.cc',
         'builtins/builtins-conversion.cc',
         'builtins/builtins-constructor.cc',
         'builtins/builtins-constructor.h',
@@ -847,6 +848,8 @@
         'debug/interface-types.h',
         'debug/liveedit.cc',
         'debug/liveedit.h',
+        'deoptimization-log.cc',
+        'deoptimization-log.h',
         'deoptimize-reason.cc',
         'deoptimize-reason.h',
         'deoptimizer.cc',
@@ -1076,6 +1079,8 @@
         'objects/object-macros.h',
         'objects/object-macros-undef.h',
         'objects/scope-info.h',
+        'optimization-profile.cc',
+        'optimization-profile.h',
         'ostreams.cc',
         'ostreams.h',
         'parsing/duplicate-finder.cc',
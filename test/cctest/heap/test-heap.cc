@@ -1361,6 +1361,173 @@ TEST(TestCodeFlushingPreAged) {
 }
 
 
+TEST(TestBytecodeFlushing) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code || i::FLAG_always_opt) return;
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source = "function foo() {"
+                       "  var x = 42;"
+                       "  var y = 42;"
+                       "  var z = x + y;"
+                       "};"
+                       "foo()";
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+  { v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+  }
+
+  // Check function is interpreted.
+  Handle<Object> func_value =
+      Object::GetProperty(isolate->global_object(), foo_name).ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  CHECK(function->shared()->HasBytecodeArray());
+  CHECK(function->IsInterpreted());
+
+  // The bytecode will survive at least two GCs.
+  CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  CHECK(function->shared()->HasBytecodeArray());
+
+  // Simulate several GCs that use full marking.
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  }
+
+  // The bytecode of foo is gone and both the closure and the shared function
+  // info are lazy again.
+  CHECK(!function->shared()->HasBytecodeArray());
+  CHECK(!function->shared()->is_compiled());
+  CHECK(!function->is_compiled());
+
+  // Call foo to get it recompiled.
+  CompileRun("foo()");
+  CHECK(function->shared()->HasBytecodeArray());
+  CHECK(function->shared()->is_compiled());
+  CHECK(function->is_compiled());
+}
+
+
+TEST(TestBytecodeFlushingMultipleCandidates) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code || i::FLAG_always_opt) return;
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  // All interpreted functions share the interpreter entry trampoline, so
+  // every one of the cold functions below must be tracked on its own.
+  const char* source =
+      "function foo1() { var x = 1; return x + 1; };"
+      "function foo2() { var x = 2; return x + 2; };"
+      "function foo3() { var x = 3; return x + 3; };"
+      "function bar() { var x = 4; return x + 4; };"
+      "foo1(); foo2(); foo3(); bar();";
+  { v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+  }
+
+  const char* const kColdNames[] = {"foo1", "foo2", "foo3"};
+  const int kColdCount = arraysize(kColdNames);
+  Handle<JSFunction> cold[kColdCount];
+  for (int i = 0; i < kColdCount; i++) {
+    Handle<String> name = factory->InternalizeUtf8String(kColdNames[i]);
+    Handle<Object> value =
+        Object::GetProperty(isolate->global_object(), name).ToHandleChecked();
+    cold[i] = Handle<JSFunction>::cast(value);
+    CHECK(cold[i]->shared()->HasBytecodeArray());
+  }
+  Handle<String> bar_name = factory->InternalizeUtf8String("bar");
+  Handle<JSFunction> hot = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(), bar_name)
+          .ToHandleChecked());
+  CHECK(hot->shared()->HasBytecodeArray());
+
+  // Simulate several GCs that use full marking, while bar keeps running.
+  const int kAgingThreshold = 8;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CompileRun("bar();");
+    CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  }
+
+  // The bytecode of all cold functions is gone, bar still has its bytecode.
+  for (int i = 0; i < kColdCount; i++) {
+    CHECK(!cold[i]->shared()->HasBytecodeArray());
+    CHECK(!cold[i]->shared()->is_compiled());
+    CHECK(!cold[i]->is_compiled());
+  }
+  CHECK(hot->shared()->HasBytecodeArray());
+  CHECK(hot->is_compiled());
+
+  // Calling the cold functions recompiles them.
+  CHECK_EQ(2 + 4 + 6, CompileRun("foo1() + foo2() + foo3();")
+                          ->Int32Value(CcTest::isolate()->GetCurrentContext())
+                          .FromJust());
+  for (int i = 0; i < kColdCount; i++) {
+    CHECK(cold[i]->shared()->HasBytecodeArray());
+    CHECK(cold[i]->is_compiled());
+  }
+}
+
+TEST(TestBytecodeFlushingBlackOptimizedCode) {
+  if (!i::FLAG_incremental_marking || !i::FLAG_turbo) return;
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code || i::FLAG_always_opt) return;
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function inner(x) { return x + 1; };"
+      "function outer(x) { return inner(x); };"
+      "outer(1); outer(2);";
+  { v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+  }
+
+  Handle<String> outer_name = factory->InternalizeUtf8String("outer");
+  Handle<JSFunction> outer = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(), outer_name)
+          .ToHandleChecked());
+  Handle<String> inner_name = factory->InternalizeUtf8String("inner");
+  Handle<JSFunction> inner = Handle<JSFunction>::cast(
+      Object::GetProperty(isolate->global_object(), inner_name)
+          .ToHandleChecked());
+  CHECK(outer->shared()->HasBytecodeArray());
+  CHECK(inner->shared()->HasBytecodeArray());
+
+  // Both functions look cold when marking visits them.
+  outer->shared()->bytecode_array()->set_bytecode_age(
+      BytecodeArray::kIsOldBytecodeAge);
+  inner->shared()->bytecode_array()->set_bytecode_age(
+      BytecodeArray::kIsOldBytecodeAge);
+  heap::SimulateIncrementalMarking(CcTest::heap());
+
+  // The optimized code inlining inner is allocated black and is not visited
+  // before marking finishes.
+  CompileRun("%OptimizeFunctionOnNextCall(outer); outer(3);");
+  CHECK(outer->IsOptimized());
+  CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+
+  // Both functions keep the bytecode that the optimized code deoptimizes into.
+  CHECK(outer->shared()->HasBytecodeArray());
+  CHECK(inner->shared()->HasBytecodeArray());
+  ExpectString("outer('a')", "a1");
+  CHECK(!outer->IsOptimized());
+}
+
 TEST(TestCodeFlushingIncremental) {
   if (!i::FLAG_incremental_marking) return;
   // If we do not flush code this test is invalid.
@@ -1,9 +1,12 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/platform.h"
 #include "src/tracing/trace-event.h"
 #include "test/cctest/cctest.h"
 
@@ -127,6 +130,103 @@ TEST(TestTraceBufferRingBuffer) {
   delete ring_buffer;
 }
 
+class TraceEventThread : public base::Thread {
+ public:
+  TraceEventThread(TraceBuffer* trace_buffer, const char* name,
+                   size_t event_count = kEventCount)
+      : base::Thread(Options("TraceEventThread")),
+        trace_buffer_(trace_buffer),
+        name_(name),
+        event_count_(event_count),
+        handles_valid_(true) {}
+
+  void Run() override {
+    static uint8_t category_enabled_flag = 41;
+    for (size_t i = 0; i < event_count_; ++i) {
+      uint64_t handle;
+      TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name_, nullptr, 0,
+                               0, 0, nullptr, nullptr, nullptr, nullptr, 0);
+      if (trace_buffer_->GetEventByHandle(handle) != trace_object) {
+        handles_valid_ = false;
+      }
+    }
+  }
+
+  bool handles_valid() const { return handles_valid_; }
+
+  static const size_t kEventCount = TraceBufferChunk::kChunkSize * 3 + 5;
+
+ private:
+  TraceBuffer* trace_buffer_;
+  const char* name_;
+  size_t event_count_;
+  bool handles_valid_;
+};
+
+TEST(TestTraceBufferRingBufferThreads) {
+  // Threads add events to chunks of their own, nothing gets lost or
+  // overwritten while the buffer has room.
+  const int kThreadCount = 4;
+  const char* names[kThreadCount] = {"Thread0", "Thread1", "Thread2",
+                                     "Thread3"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer = TraceBuffer::CreateTraceBufferRingBuffer(
+      kThreadCount * 5, writer);
+  std::vector<std::unique_ptr<TraceEventThread>> threads;
+  for (int i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back(new TraceEventThread(ring_buffer, names[i]));
+  }
+  for (auto& thread : threads) thread->Start();
+  for (auto& thread : threads) thread->Join();
+  for (auto& thread : threads) CHECK(thread->handles_valid());
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(kThreadCount * TraceEventThread::kEventCount, events.size());
+  for (int i = 0; i < kThreadCount; ++i) {
+    CHECK_EQ(TraceEventThread::kEventCount,
+             static_cast<size_t>(
+                 std::count(events.begin(), events.end(), names[i])));
+  }
+  delete ring_buffer;
+}
+
+TEST(TestTraceBufferRingBufferExitedThreads) {
+  // Threads that exited keep their chunks until the ring comes back to them
+  // a second time, then the chunks are overwritten like any other.
+  const int kThreadCount = 2;
+  const char* names[kThreadCount] = {"Thread0", "Thread1"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(kThreadCount, writer);
+  for (int i = 0; i < kThreadCount; ++i) {
+    TraceEventThread thread(ring_buffer, names[i], 1);
+    thread.Start();
+    thread.Join();
+    CHECK(thread.handles_valid());
+  }
+
+  static uint8_t category_enabled_flag = 41;
+  const size_t kEventCount = kThreadCount * TraceBufferChunk::kChunkSize;
+  for (size_t i = 0; i < kEventCount; ++i) {
+    uint64_t handle;
+    TraceObject* trace_object = ring_buffer->AddTraceEvent(&handle);
+    CHECK_NOT_NULL(trace_object);
+    trace_object->Initialize('X', &category_enabled_flag, "Main", nullptr, 0,
+                             0, 0, nullptr, nullptr, nullptr, nullptr, 0);
+    CHECK_EQ(trace_object, ring_buffer->GetEventByHandle(handle));
+  }
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(kEventCount, events.size());
+  CHECK_EQ(kEventCount, static_cast<size_t>(
+                            std::count(events.begin(), events.end(), "Main")));
+  delete ring_buffer;
+}
+
 TEST(TestJSONTraceWriter) {
   std::ostringstream stream;
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
@@ -151,10 +251,14 @@ TEST(TestJSONTraceWriter) {
         v8::internal::tracing::kGlobalScope, 42, 123, 0, nullptr, nullptr,
         nullptr, nullptr, TRACE_EVENT_FLAG_HAS_ID, 11, 22, 100, 50, 33, 44);
     writer->AppendTraceEvent(&trace_object);
+    const char* arg_names[] = {"arg"};
+    const uint8_t arg_types[] = {TRACE_VALUE_TYPE_COPY_STRING};
+    const uint64_t arg_values[] = {
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>("value"))};
     trace_object.InitializeForTesting(
         'Y', tracing_controller.GetCategoryGroupEnabled("v8-cat"), "Test1",
-        v8::internal::tracing::kGlobalScope, 43, 456, 0, nullptr, nullptr,
-        nullptr, nullptr, 0, 55, 66, 110, 55, 77, 88);
+        v8::internal::tracing::kGlobalScope, 43, 456, 1, arg_names, arg_types,
+        arg_values, nullptr, 0, 55, 66, 110, 55, 77, 88);
     writer->AppendTraceEvent(&trace_object);
     tracing_controller.StopTracing();
   }
@@ -172,6 +276,60 @@ TEST(TestJSONTraceWriter) {
   i::V8::SetPlatformForTesting(old_platform);
 }
 
+TEST(TestBinaryTraceWriter) {
+  std::ostringstream stream;
+  v8::Platform* old_platform = i::V8::GetCurrentPlatform();
+  v8::Platform* default_platform = v8::platform::CreateDefaultPlatform();
+  i::V8::SetPlatformForTesting(default_platform);
+  // Create a scope for the tracing controller to terminate the trace writer.
+  {
+    TracingController tracing_controller;
+    platform::SetTracingController(default_platform, &tracing_controller);
+    TraceWriter* writer = TraceWriter::CreateBinaryTraceWriter(stream);
+
+    TraceBuffer* ring_buffer =
+        TraceBuffer::CreateTraceBufferRingBuffer(1, writer);
+    tracing_controller.Initialize(ring_buffer);
+    TraceConfig* trace_config = new TraceConfig();
+    trace_config->AddIncludedCategory("v8-cat");
+    tracing_controller.StartTracing(trace_config);
+
+    TraceObject trace_object;
+    trace_object.InitializeForTesting(
+        'X', tracing_controller.GetCategoryGroupEnabled("v8-cat"), "Test0",
+        v8::internal::tracing::kGlobalScope, 42, 123, 0, nullptr, nullptr,
+        nullptr, nullptr, TRACE_EVENT_FLAG_HAS_ID, 11, 22, 100, 50, 33, 44);
+    writer->AppendTraceEvent(&trace_object);
+    const char* arg_names[] = {"arg"};
+    const uint8_t arg_types[] = {TRACE_VALUE_TYPE_COPY_STRING};
+    const uint64_t arg_values[] = {
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>("value"))};
+    trace_object.InitializeForTesting(
+        'Y', tracing_controller.GetCategoryGroupEnabled("v8-cat"), "Test1",
+        v8::internal::tracing::kGlobalScope, 43, 456, 1, arg_names, arg_types,
+        arg_values, nullptr, 0, 55, 66, 110, 55, 77, 88);
+    writer->AppendTraceEvent(&trace_object);
+    tracing_controller.StopTracing();
+  }
+
+  // Strings are written once, before the first event that uses them, arg
+  // values are written inline. Times are relative to the previous event.
+  const char expected_trace[] =
+      "V8TR\x02"
+      "\x01\x06v8-cat"
+      "\x01\x05Test0"
+      "\x02X\x0b\x16\xc8\x01\x64\x21\x2c\x01\x02\x02\x00\x2a\x00"
+      "\x01\x05Test1"
+      "\x01\x03"
+      "arg"
+      "\x02Y\x37\x42\x14\x0a\x4d\x58\x01\x03\x00\x01\x04\x07\x06value"
+      "\x00";
+  CHECK_EQ(std::string(expected_trace, sizeof(expected_trace) - 1),
+           stream.str());
+
+  i::V8::SetPlatformForTesting(old_platform);
+}
+
 TEST(TestTracingController) {
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
   v8::Platform* default_platform = v8::platform::CreateDefaultPlatform();
@@ -201,6 +359,102 @@ TEST(TestTracingController) {
   i::V8::SetPlatformForTesting(old_platform);
 }
 
+// Only counts the events, threads that are still adding an event when tracing
+// stops may not have initialized it yet.
+class CountingTraceWriter : public TraceWriter {
+ public:
+  void AppendTraceEvent(TraceObject* trace_event) override {
+    ++events_since_flush_;
+  }
+
+  void Flush() override {
+    max_events_per_flush_ =
+        std::max(max_events_per_flush_, events_since_flush_);
+    events_ += events_since_flush_;
+    events_since_flush_ = 0;
+  }
+
+  size_t events() const { return events_; }
+  size_t max_events_per_flush() const { return max_events_per_flush_; }
+
+ private:
+  size_t events_ = 0;
+  size_t events_since_flush_ = 0;
+  size_t max_events_per_flush_ = 0;
+};
+
+class TracingControllerThread : public base::Thread {
+ public:
+  TracingControllerThread(TracingController* tracing_controller,
+                          const uint8_t* category_enabled_flag,
+                          base::AtomicNumber<int>* added,
+                          base::AtomicValue<bool>* stop)
+      : base::Thread(Options("TracingControllerThread")),
+        tracing_controller_(tracing_controller),
+        category_enabled_flag_(category_enabled_flag),
+        added_(added),
+        stop_(stop) {}
+
+  void Run() override {
+    while (!stop_->Value()) {
+      if (*category_enabled_flag_) {
+        tracing_controller_->AddTraceEvent('X', category_enabled_flag_,
+                                           "Thread", nullptr, 0, 0, 0, nullptr,
+                                           nullptr, nullptr, nullptr, 0);
+        added_->Increment(1);
+      }
+    }
+  }
+
+ private:
+  TracingController* tracing_controller_;
+  const uint8_t* category_enabled_flag_;
+  base::AtomicNumber<int>* added_;
+  base::AtomicValue<bool>* stop_;
+};
+
+TEST(TestTracingControllerStopWhileAddingEvents) {
+  // Stopping flushes the buffer while other threads are still adding events
+  // to chunks of their own.
+  const int kThreadCount = 4;
+  const int kRounds = 20;
+  TracingController tracing_controller;
+  CountingTraceWriter* writer = new CountingTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(kThreadCount, writer);
+  tracing_controller.Initialize(ring_buffer);
+  const uint8_t* category_enabled_flag =
+      tracing_controller.GetCategoryGroupEnabled("v8");
+
+  base::AtomicNumber<int> added(0);
+  base::AtomicValue<bool> stop(false);
+  std::vector<std::unique_ptr<TracingControllerThread>> threads;
+  for (int i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back(new TracingControllerThread(
+        &tracing_controller, category_enabled_flag, &added, &stop));
+    threads.back()->Start();
+  }
+
+  for (int i = 0; i < kRounds; ++i) {
+    TraceConfig* trace_config = new TraceConfig();
+    trace_config->AddIncludedCategory("v8");
+    tracing_controller.StartTracing(trace_config);
+    // Stop once the threads are busy adding events.
+    int target = added.Value() + kThreadCount * 100;
+    while (added.Value() < target) {
+    }
+    tracing_controller.StopTracing();
+  }
+
+  stop.SetValue(true);
+  for (auto& thread : threads) thread->Join();
+
+  // The ring never holds more than its capacity, whoever added the events.
+  CHECK_LT(0u, writer->events());
+  CHECK_LE(writer->max_events_per_flush(),
+           kThreadCount * TraceBufferChunk::kChunkSize);
+}
+
 void GetJSONStrings(std::vector<std::string>& ret, std::string str,
                     std::string param, std::string start_delim,
                     std::string end_delim) {
@@ -137,5 +137,39 @@ TEST(LibSamplerCollectSample) {
   RunSampler(env.local(), function, args, arraysize(args), 100, 100);
 }
 
+
+TEST(LibSamplerPerfEventSample) {
+  // The task clock is a software event, it does not need access to the PMU.
+  if (!Sampler::IsPerfEventSupported(Sampler::kPerfTaskClock)) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  env->Global()
+      ->Set(env.local(), v8_str("instance"), v8::Object::New(isolate))
+      .FromJust();
+  CompileRun(sampler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  int32_t repeat_count = 1000;
+  v8::Local<v8::Value> args[] = {v8::Integer::New(isolate, repeat_count)};
+
+  // No sampling thread, the kernel signals every 100us of CPU time.
+  Sampler::SetUp();
+  TestSampler* sampler = new TestSampler(isolate);
+  sampler->IncreaseProfilingDepth();
+  CHECK(sampler->StartPerfEventSampling(Sampler::kPerfTaskClock, 100000));
+  CHECK(sampler->IsPerfEventSampling());
+  sampler->StartCountingSamples();
+  do {
+    function->Call(env.local(), env->Global(), arraysize(args), args)
+        .ToLocalChecked();
+  } while (sampler->js_sample_count() < 100);
+  sampler->StopPerfEventSampling();
+  CHECK(!sampler->IsPerfEventSampling());
+  sampler->DecreaseProfilingDepth();
+  delete sampler;
+  Sampler::TearDown();
+}
+
 }  // namespace sampler
 }  // namespace v8
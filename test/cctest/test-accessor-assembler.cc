@@ -21,6 +21,7 @@ namespace {
 
 void TestStubCacheOffsetCalculation(StubCache::Table table) {
   Isolate* isolate(CcTest::InitIsolateOnce());
+  StubCache* stub_cache = isolate->load_stub_cache();
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams);
   AccessorAssemblerImpl m(data.state());
@@ -28,13 +29,15 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   {
     Node* name = m.Parameter(0);
     Node* map = m.Parameter(1);
-    Node* primary_offset = m.StubCachePrimaryOffsetForTesting(name, map);
+    Node* primary_offset =
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -77,12 +80,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -125,7 +128,7 @@ TEST(TryProbeStubCache) {
 
   Code::Kind ic_kind = Code::LOAD_IC;
   StubCache stub_cache(isolate, ic_kind);
-  stub_cache.Clear();
+  stub_cache.Initialize();
 
   {
     Node* receiver = m.Parameter(0);
@@ -166,21 +169,23 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  for (int i = 0; i < stub_cache.primary_table_size() / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) %
+               stub_cache.primary_table_size());
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) %
+               stub_cache.primary_table_size());
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -196,7 +201,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < stub_cache.secondary_table_size() / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -213,7 +218,8 @@ TEST(TryProbeStubCache) {
   DisallowHeapAllocation no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N =
+      stub_cache.primary_table_size() + stub_cache.secondary_table_size();
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -257,6 +263,31 @@ TEST(TryProbeStubCache) {
   }
   // Ensure we performed both kind of queries.
   CHECK(queried_existing && queried_non_existing);
+
+  if (!FLAG_adaptive_stub_cache) return;
+
+  // Populating the cache missed more often than it has entries, so clearing
+  // it grows the tables. The same code must probe the new ones.
+  int old_size = stub_cache.primary_table_size();
+  CHECK_LT(old_size, stub_cache.misses());
+  stub_cache.Clear();
+  CHECK_EQ(2 * old_size, stub_cache.primary_table_size());
+  CHECK_EQ(0, stub_cache.misses());
+  for (int i = 0; i < N; i++) {
+    int index = rand_gen.NextInt();
+    Handle<Name> name = names[index % names.size()];
+    Handle<JSObject> receiver = receivers[index % receivers.size()];
+    Handle<Code> handler = handlers[index % handlers.size()];
+    stub_cache.Set(*name, receiver->map(), *handler);
+  }
+  for (int i = 0; i < N; i++) {
+    int index = rand_gen.NextInt();
+    Handle<Name> name = names[index % names.size()];
+    Handle<JSObject> receiver = receivers[index % receivers.size()];
+    Object* handler = stub_cache.Get(*name, receiver->map());
+    Handle<Object> expected_handler(handler, isolate);
+    ft.CheckTrue(receiver, name, expected_handler);
+  }
 }
 
 }  // namespace internal
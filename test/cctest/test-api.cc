@@ -46,9 +46,13 @@
 #include "src/debug/debug.h"
 #include "src/execution.h"
 #include "src/futex-emulation.h"
+#include "src/heap/gc-tracer.h"
+#include "src/ic/stub-cache.h"
 #include "src/objects.h"
+#include "src/optimization-profile.h"
 #include "src/parsing/preparse-data.h"
 #include "src/profiler/cpu-profiler.h"
+#include "src/runtime-profiler.h"
 #include "src/unicode-inl.h"
 #include "src/utils.h"
 #include "src/vm-state.h"
@@ -18727,6 +18731,221 @@ THREADED_TEST(GetHeapStatistics) {
 }
 
 
+class FunctionStatisticsCollector : public v8::FunctionStatisticsVisitor {
+ public:
+  FunctionStatisticsCollector()
+      : found(false),
+        in_function(false),
+        tier(v8::FunctionStatistics::kNotCompiled),
+        megamorphic_count(0),
+        megamorphic_load_ic_count(0) {}
+
+  void VisitFunction(v8::FunctionStatistics* function) override {
+    in_function = strcmp("f", function->function_name()) == 0;
+    if (!in_function) return;
+    found = true;
+    tier = function->tier();
+    CHECK_LT(0u, function->code_size());
+    megamorphic_count =
+        function->ic_count(v8::FunctionStatistics::kMegamorphic);
+  }
+
+  void VisitInlineCache(v8::FunctionStatistics* function, int slot,
+                        const char* kind,
+                        v8::FunctionStatistics::ICState state) override {
+    if (!in_function || strcmp("LOAD_IC", kind) != 0) return;
+    if (state == v8::FunctionStatistics::kMegamorphic) {
+      megamorphic_load_ic_count++;
+    }
+  }
+
+  bool found;
+  bool in_function;
+  v8::FunctionStatistics::Tier tier;
+  int megamorphic_count;
+  int megamorphic_load_ic_count;
+};
+
+TEST(VisitFunctionStatistics) {
+  if (i::FLAG_always_opt) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Script> script = v8_compile(
+      "function f(o) { return o.x; }"
+      "function g() {}"
+      "var objects = [{x: 1}, {x: 1, a: 1}, {x: 1, b: 1}, {x: 1, c: 1},"
+      "               {x: 1, d: 1}, {x: 1, e: 1}];"
+      "for (var i = 0; i < objects.length; i++) f(objects[i]);");
+  script->Run(env.local()).ToLocalChecked();
+  int script_id = script->GetUnboundScript()->GetId();
+
+  FunctionStatisticsCollector collector;
+  isolate->VisitFunctionStatistics(env.local(), script_id, &collector);
+  CHECK(collector.found);
+  CHECK_NE(v8::FunctionStatistics::kNotCompiled, collector.tier);
+  CHECK_EQ(1, collector.megamorphic_count);
+  CHECK_EQ(1, collector.megamorphic_load_ic_count);
+
+  // Other scripts are not visited.
+  FunctionStatisticsCollector other_collector;
+  isolate->VisitFunctionStatistics(env.local(), script_id + 1000,
+                                   &other_collector);
+  CHECK(!other_collector.found);
+}
+
+TEST(GetRuntimeCallStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->SetRuntimeCallStatsSamplingInterval(1);
+  isolate->ResetRuntimeCallStatistics();
+  for (int i = 0; i < 10; i++) v8::Object::New(isolate);
+  isolate->SetRuntimeCallStatsSamplingInterval(0);
+
+  v8::RuntimeCallStatistics statistics;
+  bool found = false;
+  for (size_t i = 0; i < isolate->NumberOfRuntimeCallCounters(); i++) {
+    CHECK(isolate->GetRuntimeCallStatistics(&statistics, i));
+    CHECK_NOT_NULL(statistics.counter_name());
+    if (strcmp(statistics.counter_name(), "API_Object_New") != 0) continue;
+    found = true;
+    CHECK_EQ(10u, statistics.call_count());
+    CHECK_LE(statistics.median_time(), statistics.p99_time());
+    CHECK_LE(statistics.p99_time(), statistics.max_time());
+    CHECK_LE(statistics.max_time(), statistics.total_time());
+  }
+  CHECK(found);
+  CHECK(!isolate->GetRuntimeCallStatistics(
+      &statistics, isolate->NumberOfRuntimeCallCounters()));
+
+  isolate->ResetRuntimeCallStatistics();
+  for (size_t i = 0; i < isolate->NumberOfRuntimeCallCounters(); i++) {
+    CHECK(isolate->GetRuntimeCallStatistics(&statistics, i));
+    CHECK_EQ(0u, statistics.call_count());
+  }
+}
+
+
+static int runtime_call_stats_api_calls = 0;
+
+static void CountRuntimeCallStatsApiCalls(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  runtime_call_stats_api_calls++;
+}
+
+static size_t GetRuntimeCallCount(v8::Isolate* isolate, const char* name) {
+  v8::RuntimeCallStatistics statistics;
+  for (size_t i = 0; i < isolate->NumberOfRuntimeCallCounters(); i++) {
+    CHECK(isolate->GetRuntimeCallStatistics(&statistics, i));
+    if (strcmp(statistics.counter_name(), name) == 0) {
+      return statistics.call_count();
+    }
+  }
+  UNREACHABLE();
+  return 0;
+}
+
+TEST(GetRuntimeCallStatisticsKeepsApiCallsInlined) {
+  // Recording histograms must not keep the compilers from calling API
+  // functions directly, which they do not do under FLAG_runtime_stats.
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->SetRuntimeCallStatsSamplingInterval(1);
+  CHECK_EQ(0, i::FLAG_runtime_stats);
+
+  Local<v8::FunctionTemplate> templ =
+      v8::FunctionTemplate::New(isolate, CountRuntimeCallStatsApiCalls);
+  CHECK(env->Global()
+            ->Set(env.local(), v8_str("api"),
+                  templ->GetFunction(env.local()).ToLocalChecked())
+            .FromJust());
+  CompileRun(
+      "function f() { api(); api(); }"
+      "f(); f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f();"
+      "function g() { api(); }"
+      "%NeverOptimizeFunction(g);");
+
+  // Unoptimized code calls API functions through the HandleApiCall builtin.
+  isolate->ResetRuntimeCallStatistics();
+  runtime_call_stats_api_calls = 0;
+  CompileRun("for (var i = 0; i < 10; i++) g();");
+  CHECK_EQ(10, runtime_call_stats_api_calls);
+  CHECK_EQ(10u, GetRuntimeCallCount(isolate, "HandleApiCall"));
+
+  // Optimized code calls them directly.
+  isolate->ResetRuntimeCallStatistics();
+  runtime_call_stats_api_calls = 0;
+  CompileRun("for (var i = 0; i < 10; i++) f();");
+  CHECK_EQ(20, runtime_call_stats_api_calls);
+  CHECK_EQ(0u, GetRuntimeCallCount(isolate, "HandleApiCall"));
+  isolate->SetRuntimeCallStatsSamplingInterval(0);
+}
+
+
+struct GCPauseCallbackData {
+  int pause_count;
+  size_t pause_time;
+};
+
+static void CountGCPauses(v8::Isolate* isolate, const v8::GCPauseInfo& info,
+                          void* data) {
+  GCPauseCallbackData* callback_data = static_cast<GCPauseCallbackData*>(data);
+  CHECK_EQ(isolate->NumberOfGCPauseScopes(), info.scope_count);
+  size_t whole_pauses = 0;
+  for (size_t i = i::GCTracer::Scope::NUMBER_OF_SCOPES; i < info.scope_count;
+       i++) {
+    whole_pauses += info.scope_times[i];
+  }
+  CHECK_EQ(info.pause_time, whole_pauses);
+  CHECK_LE(info.scope_times[i::GCTracer::Scope::MC_MARK], info.pause_time);
+  callback_data->pause_count++;
+  callback_data->pause_time += info.pause_time;
+}
+
+TEST(GetGCPauseStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  GCPauseCallbackData data = {0, 0};
+  isolate->SetGCPauseCallback(CountGCPauses, &data);
+  isolate->ResetGCPauseStatistics();
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  isolate->SetGCPauseCallback(nullptr);
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  // Stress variants may add garbage collections of their own.
+  CHECK_LE(2, data.pause_count);
+
+  v8::GCPauseStatistics statistics;
+  size_t pause_count = 0;
+  for (size_t i = 0; i < isolate->NumberOfGCPauseScopes(); i++) {
+    CHECK(isolate->GetGCPauseStatistics(&statistics, i));
+    CHECK_NOT_NULL(statistics.scope_name());
+    CHECK_LE(statistics.median_time(), statistics.p99_time());
+    CHECK_LE(statistics.p99_time(), statistics.max_time());
+    if (i >= i::GCTracer::Scope::NUMBER_OF_SCOPES) {
+      pause_count += statistics.pause_count();
+    }
+  }
+  CHECK_LE(3u, pause_count);
+  // Pauses are still recorded after the callback is removed.
+  CHECK_LT(static_cast<size_t>(data.pause_count), pause_count);
+  CHECK(!isolate->GetGCPauseStatistics(&statistics,
+                                       isolate->NumberOfGCPauseScopes()));
+
+  isolate->ResetGCPauseStatistics();
+  for (size_t i = 0; i < isolate->NumberOfGCPauseScopes(); i++) {
+    CHECK(isolate->GetGCPauseStatistics(&statistics, i));
+    CHECK_EQ(0u, statistics.pause_count());
+  }
+}
+
+
 class VisitorImpl : public v8::ExternalResourceVisitor {
  public:
   explicit VisitorImpl(TestResource** resource) {
@@ -26636,3 +26855,100 @@ UNINITIALIZED_TEST(IncreaseHeapLimitForDebugging) {
   }
   isolate->Dispose();
 }
+
+UNINITIALIZED_TEST(StubCacheSize) {
+  using namespace i;
+  v8::Isolate::CreateParams create_params;
+  create_params.constraints.set_stub_cache_size(5000);
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  // The requested size is rounded up to a power of two.
+  CHECK_EQ(8192, i_isolate->load_stub_cache()->primary_table_size());
+  CHECK_EQ(2048, i_isolate->load_stub_cache()->secondary_table_size());
+  CHECK_EQ(8192, i_isolate->store_stub_cache()->primary_table_size());
+  isolate->Dispose();
+}
+
+static bool sample_optimization_candidates = false;
+
+static void SampleOptimizationCandidates(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  if (!sample_optimization_candidates) return;
+  i::RuntimeProfiler* profiler = CcTest::i_isolate()->runtime_profiler();
+  // Make sure that small functions are not optimized optimistically.
+  profiler->NotifyICChanged();
+  profiler->MarkCandidatesForOptimization();
+}
+
+static i::Handle<i::JSFunction> GetGlobalFunction(
+    v8::Local<v8::Context> context, const char* name) {
+  return i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(
+      *context->Global()->Get(context, v8_str(name)).ToLocalChecked()));
+}
+
+static bool IsMarkedOrOptimized(i::Handle<i::JSFunction> function) {
+  return function->IsMarkedForOptimization() ||
+         function->IsMarkedForConcurrentOptimization() ||
+         function->IsInOptimizationQueue() || function->IsOptimized();
+}
+
+TEST(OptimizationProfile) {
+  if (i::FLAG_always_opt || !CcTest::i_isolate()->use_crankshaft()) return;
+  i::FLAG_allow_natives_syntax = true;
+  // Every context has to compile the script from scratch.
+  i::FLAG_compilation_cache = false;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+  global->Set(v8_str("sample"),
+              v8::FunctionTemplate::New(isolate, SampleOptimizationCandidates));
+  const char* source =
+      "function f(x) { sample(); return x + 1; }"
+      "function g(x) { sample(); return x + 1; }";
+
+  v8::StartupData profile;
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate, NULL, global);
+    v8::Context::Scope context_scope(context);
+    CompileRun(source);
+    CompileRun("f(1); f(2); %OptimizeFunctionOnNextCall(f); f(3); g(1);");
+    profile = isolate->CreateOptimizationProfile();
+  }
+  CHECK_NOT_NULL(profile.data);
+  CHECK_EQ(0, profile.raw_size % sizeof(uint32_t));
+
+  // Truncated or corrupted profiles are rejected.
+  v8::StartupData truncated = {profile.data, profile.raw_size - 1};
+  CHECK(!isolate->SetOptimizationProfile(&truncated));
+  v8::StartupData empty = {profile.data, 0};
+  CHECK(!isolate->SetOptimizationProfile(&empty));
+  CHECK(isolate->SetOptimizationProfile(&profile));
+
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate, NULL, global);
+    v8::Context::Scope context_scope(context);
+    CompileRun(source);
+
+    // The profile records {f}, which was optimized, but not {g}.
+    std::unique_ptr<i::OptimizationProfile> deserialized(
+        i::OptimizationProfile::Deserialize(profile.data, profile.raw_size));
+    CHECK_NOT_NULL(deserialized.get());
+    i::Handle<i::JSFunction> f = GetGlobalFunction(context, "f");
+    i::Handle<i::JSFunction> g = GetGlobalFunction(context, "g");
+    CHECK(deserialized->IsHot(f->shared()));
+    CHECK(!deserialized->IsHot(g->shared()));
+
+    // Collect feedback first, then sample each function once. Only {f} is
+    // picked for optimization, {g} still has to accumulate ticks.
+    CompileRun("f(1); g(1);");
+    CHECK(!IsMarkedOrOptimized(f));
+    CHECK(!IsMarkedOrOptimized(g));
+    sample_optimization_candidates = true;
+    CompileRun("f(2); g(2);");
+    sample_optimization_candidates = false;
+    CHECK(IsMarkedOrOptimized(f));
+    CHECK(!IsMarkedOrOptimized(g));
+  }
+  delete[] profile.data;
+}
@@ -619,6 +619,38 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+TEST(CollectCpuProfileOnPerfEvents) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  CHECK(!helper.profiler()->SetSamplingEvent(v8::CpuProfiler::kCpuTime, 0));
+  // CPU time is a software event, it does not need access to the PMU.
+  if (!helper.profiler()->SetSamplingEvent(v8::CpuProfiler::kCpuTime,
+                                           100000)) {
+    return;
+  }
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 200);
+
+  const v8::CpuProfileNode* root = profile->GetTopDownRoot();
+  const v8::CpuProfileNode* start_node = GetChild(env.local(), root, "start");
+  const v8::CpuProfileNode* foo_node = GetChild(env.local(), start_node, "foo");
+  const char* delay_branch[] = {"delay", "loop"};
+  CheckSimpleBranch(env.local(), foo_node, delay_branch,
+                    arraysize(delay_branch));
+
+  profile->Delete();
+  CHECK(helper.profiler()->SetSamplingEvent(
+      v8::CpuProfiler::kSamplingInterval, 0));
+}
+
 static const char* hot_deopt_no_frame_entry_test_source =
     "%NeverOptimizeFunction(foo);\n"
     "%NeverOptimizeFunction(start);\n"
@@ -933,3 +933,51 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+
+TEST(DeoptimizationEvents) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->ClearDeoptimizationEvents();
+  CHECK_EQ(0u, isolate->NumberOfDeoptimizationEvents());
+
+  {
+    AllowNativesSyntaxNoInlining options;
+    CompileRun(
+        "function f(o) { return o.x; }"
+        "f({x: 1}); f({x: 2});"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f({x: 3});");
+    CHECK(GetJSFunction(env.local(), "f")->IsOptimized());
+    // Deoptimize on a map that f has not seen.
+    CompileRun("f({y: 1, x: 4});");
+    CHECK(!GetJSFunction(env.local(), "f")->IsOptimized());
+  }
+
+  CHECK_LE(1u, isolate->NumberOfDeoptimizationEvents());
+  v8::DeoptimizationEvent event;
+  CHECK(isolate->GetDeoptimizationEvent(
+      &event, isolate->NumberOfDeoptimizationEvents() - 1));
+  CHECK_EQ(0, strcmp("f", event.function_name()));
+  CHECK_EQ(0, strcmp("eager", event.bailout_type()));
+  CHECK_NOT_NULL(event.reason());
+  CHECK_LE(0, event.script_id());
+  CHECK_EQ(1u, event.count());
+  CHECK(!isolate->GetDeoptimizationEvent(
+      &event, isolate->NumberOfDeoptimizationEvents()));
+
+  v8::DeoptimizationEvent sites[4];
+  size_t site_count = isolate->GetTopDeoptimizationSites(sites, 4);
+  CHECK_LE(1u, site_count);
+  size_t deopt_count = 0;
+  for (size_t i = 0; i < site_count; i++) {
+    if (i > 0) CHECK_LE(sites[i].count(), sites[i - 1].count());
+    deopt_count += sites[i].count();
+  }
+  CHECK_EQ(isolate->NumberOfDeoptimizationEvents(), deopt_count);
+
+  isolate->ClearDeoptimizationEvents();
+  CHECK_EQ(0u, isolate->NumberOfDeoptimizationEvents());
+  CHECK_EQ(0u, isolate->GetTopDeoptimizationSites(sites, 4));
+}
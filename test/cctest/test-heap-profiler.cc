@@ -30,6 +30,8 @@
 #include <ctype.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "src/v8.h"
 
@@ -226,6 +228,43 @@ TEST(HeapSnapshotObjectSizes) {
 }
 
 
+TEST(HeapSnapshotRetainedSizes) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  //   -a-> X1 --a
+  // x -b-> X2 <-|
+  CompileRun(
+      "function X(a, b) { this.a = a; this.b = b; }\n"
+      "x = new X(new X(), new X());\n"
+      "(function() { x.a.a = x.b; })();");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  const v8::HeapGraphNode* global = GetGlobalObject(snapshot);
+  const v8::HeapGraphNode* x =
+      GetProperty(global, v8::HeapGraphEdge::kProperty, "x");
+  CHECK(x);
+  const v8::HeapGraphNode* x1 =
+      GetProperty(x, v8::HeapGraphEdge::kProperty, "a");
+  CHECK(x1);
+  const v8::HeapGraphNode* x2 =
+      GetProperty(x, v8::HeapGraphEdge::kProperty, "b");
+  CHECK(x2);
+
+  // X2 is reachable from both x and X1, so x dominates it.
+  CHECK_EQ(x, x1->GetDominatorNode());
+  CHECK_EQ(x, x2->GetDominatorNode());
+  CHECK(!snapshot->GetRoot()->GetDominatorNode());
+
+  CHECK_GE(x1->GetRetainedSize(), x1->GetShallowSize());
+  CHECK_GE(x2->GetRetainedSize(), x2->GetShallowSize());
+  CHECK_GE(x->GetRetainedSize(), x->GetShallowSize() + x1->GetRetainedSize() +
+                                     x2->GetRetainedSize());
+  CHECK_GE(snapshot->GetRoot()->GetRetainedSize(), x->GetRetainedSize());
+}
+
+
 TEST(BoundFunctionInSnapshot) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -1061,6 +1100,133 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+class BinarySnapshotReader {
+ public:
+  explicit BinarySnapshotReader(i::Vector<char> data)
+      : data_(data), pos_(0) {}
+
+  bool done() const { return pos_ >= data_.length(); }
+  uint8_t ReadByte() {
+    CHECK_LT(pos_, data_.length());
+    return static_cast<uint8_t>(data_[pos_++]);
+  }
+  uint64_t ReadVarint() {
+    uint64_t result = 0;
+    for (int shift = 0;; shift += 7) {
+      uint8_t byte = ReadByte();
+      result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (byte < 0x80) return result;
+    }
+  }
+  int64_t ReadZigzag() {
+    uint64_t value = ReadVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+  std::string ReadString(int length) {
+    CHECK_LE(pos_ + length, data_.length());
+    std::string result(data_.start() + pos_, length);
+    pos_ += length;
+    return result;
+  }
+
+ private:
+  i::Vector<char> data_;
+  int pos_;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotBinaryStream) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A2() { this.x = {}; }\n"
+      "var a2 = new A2();");
+
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  typedef i::HeapSnapshotBinaryWriter Writer;
+  BinarySnapshotReader reader(data);
+  CHECK(reader.ReadString(4) == Writer::kMagic);
+  CHECK_EQ(static_cast<uint64_t>(Writer::kVersion), reader.ReadVarint());
+  std::vector<std::string> strings(1);
+  std::vector<uint64_t> node_types, node_names, edge_from, edge_to;
+  int64_t from = 0;
+  bool ended = false;
+  while (!ended) {
+    uint8_t tag = reader.ReadByte();
+    switch (tag) {
+      case Writer::kStringRecord:
+        strings.push_back(reader.ReadString(
+            static_cast<int>(reader.ReadVarint())));
+        break;
+      case Writer::kEdgeRecord: {
+        uint64_t type = reader.ReadVarint();
+        from += reader.ReadZigzag();
+        uint64_t name_or_index = reader.ReadVarint();
+        if (type != v8::HeapGraphEdge::kElement &&
+            type != v8::HeapGraphEdge::kHidden) {
+          CHECK_LT(name_or_index, strings.size());
+        }
+        edge_from.push_back(static_cast<uint64_t>(from));
+        edge_to.push_back(reader.ReadVarint());
+        break;
+      }
+      case Writer::kNodeRecord:
+        node_types.push_back(reader.ReadVarint());
+        node_names.push_back(reader.ReadVarint());
+        CHECK_LT(node_names.back(), strings.size());
+        reader.ReadVarint();  // id
+        reader.ReadVarint();  // self size
+        reader.ReadVarint();  // trace node id
+        break;
+      case Writer::kEndRecord:
+        ended = true;
+        break;
+      default:
+        UNREACHABLE();
+    }
+  }
+  CHECK(reader.done());
+
+  CHECK_GT(node_types.size(), 1u);
+  CHECK_GT(edge_from.size(), node_types.size());
+  for (size_t i = 0; i < edge_from.size(); ++i) {
+    CHECK_LT(edge_from[i], node_types.size());
+    CHECK_LT(edge_to[i], node_types.size());
+  }
+  // The root comes first.
+  CHECK_EQ(static_cast<uint64_t>(v8::HeapGraphNode::kSynthetic),
+           node_types[0]);
+  bool found_a2 = false;
+  for (size_t i = 0; i < node_names.size(); ++i) {
+    if (strings[node_names[i]] == "A2" &&
+        node_types[i] == v8::HeapGraphNode::kObject) {
+      found_a2 = true;
+    }
+  }
+  CHECK(found_a2);
+  // The streamed snapshot is not retained.
+  CHECK_EQ(0, heap_profiler->GetSnapshotCount());
+}
+
+TEST(HeapSnapshotBinaryStreamAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  TestJSONStream stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -3085,6 +3251,76 @@ TEST(SamplingHeapProfilerApiAllocation) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerRetention) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  v8::internal::FLAG_always_opt = false;
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(
+      64, 16, v8::HeapProfiler::kSamplingTrackRetention);
+
+  CompileRun(
+      "var kept = [];\n"
+      "function keep() { kept.push({a: 1, b: 2}); }\n"
+      "function drop() { return {a: 1, b: 2}; }\n"
+      "for (var i = 0; i < 1024; ++i) {\n"
+      "  keep();\n"
+      "  drop();\n"
+      "}\n");
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(profile);
+
+    const char* keep_names[] = {"", "keep"};
+    auto node_keep =
+        FindAllocationProfileNode(*profile, ArrayVector(keep_names));
+    CHECK(node_keep);
+    const v8::AllocationProfile::Retention& keep = node_keep->retention;
+    CHECK_GT(keep.allocated_size, 0u);
+    CHECK_GT(keep.survived_size, 0u);
+    CHECK_GT(keep.promoted_size, 0u);
+    CHECK_LE(keep.promoted_size, keep.survived_size);
+    CHECK_LE(keep.survived_size, keep.allocated_size);
+    CHECK_LE(keep.allocation_site_size, keep.allocated_size);
+
+    // Dead objects have no live allocations left, but their history is kept.
+    const char* drop_names[] = {"", "drop"};
+    auto node_drop =
+        FindAllocationProfileNode(*profile, ArrayVector(drop_names));
+    CHECK(node_drop);
+    const v8::AllocationProfile::Retention& drop = node_drop->retention;
+    CHECK_GT(drop.allocated_size, 0u);
+    CHECK_LT(drop.survived_size, drop.allocated_size / 2);
+  }
+
+  heap_profiler->StopSamplingHeapProfiler();
+
+  // Without the flag no history is recorded.
+  heap_profiler->StartSamplingHeapProfiler(64);
+  CompileRun("for (var i = 0; i < 1024; ++i) keep();\n");
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(profile);
+    const char* keep_names[] = {"", "keep"};
+    auto node_keep =
+        FindAllocationProfileNode(*profile, ArrayVector(keep_names));
+    CHECK(node_keep);
+    CHECK_EQ(0u, node_keep->retention.allocated_size);
+    CHECK_EQ(0u, node_keep->retention.survived_size);
+  }
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(v8::Isolate::GetCurrent());
   LocalContext env;
@@ -503,6 +503,88 @@ TEST(NoSamples) {
 }
 
 
+TEST(ContinuousProfileDeltas) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  CpuProfiler profiler(isolate);
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("continuous", false, 4);
+  ProfileGenerator generator(isolate, &profiles);
+  CodeEntry* entry1 = new CodeEntry(i::Logger::FUNCTION_TAG, "aaa");
+  CodeEntry* entry2 = new CodeEntry(i::Logger::FUNCTION_TAG, "bbb");
+  CodeEntry* entry3 = new CodeEntry(i::Logger::FUNCTION_TAG, "ccc");
+  generator.code_map()->AddCode(ToAddress(0x1500), entry1, 0x200);
+  generator.code_map()->AddCode(ToAddress(0x1700), entry2, 0x100);
+  generator.code_map()->AddCode(ToAddress(0x1900), entry3, 0x50);
+
+  // (root)#1 -> aaa #2 -> bbb #3 - sample1, sample2
+  TickSample sample1;
+  sample1.timestamp = v8::base::TimeTicks::HighResolutionNow();
+  sample1.pc = ToAddress(0x1710);
+  sample1.stack[0] = ToAddress(0x1520);
+  sample1.frames_count = 1;
+  generator.RecordTickSample(sample1);
+  generator.RecordTickSample(sample1);
+
+  CHECK_NULL(profiles.TakeProfileDelta("unknown"));
+  std::unique_ptr<i::CpuProfileDelta> delta(
+      profiles.TakeProfileDelta("continuous"));
+  CHECK(delta);
+  CHECK_EQ(3u, delta->nodes().size());
+  for (size_t i = 0; i < delta->nodes().size(); ++i) {
+    CHECK_EQ(static_cast<unsigned>(i + 1), delta->nodes()[i]->id());
+  }
+  CHECK_EQ(1u, delta->ticks().size());
+  CHECK_EQ(3u, delta->ticks()[0].first->id());
+  CHECK_EQ(2u, delta->ticks()[0].second);
+  CHECK_EQ(0u, delta->truncated_ticks_count());
+  CHECK(delta->start_time() <= delta->end_time());
+
+  // (root)#1 -> aaa #2 -> bbb #3 -> ccc #4 - sample2
+  //                               -> aaa (truncated) - sample3
+  TickSample sample2;
+  sample2.timestamp = v8::base::TimeTicks::HighResolutionNow();
+  sample2.pc = ToAddress(0x1910);
+  sample2.stack[0] = ToAddress(0x1710);
+  sample2.stack[1] = ToAddress(0x1510);
+  sample2.frames_count = 2;
+  generator.RecordTickSample(sample2);
+  TickSample sample3;
+  sample3.timestamp = v8::base::TimeTicks::HighResolutionNow();
+  sample3.pc = ToAddress(0x1510);
+  sample3.stack[0] = ToAddress(0x1710);
+  sample3.stack[1] = ToAddress(0x1510);
+  sample3.frames_count = 2;
+  generator.RecordTickSample(sample3);
+
+  v8::base::TimeTicks previous_end_time = delta->end_time();
+  delta.reset(profiles.TakeProfileDelta("continuous"));
+  CHECK(previous_end_time == delta->start_time());
+  CHECK_EQ(1u, delta->nodes().size());
+  CHECK_EQ(4u, delta->nodes()[0]->id());
+  CHECK_EQ(3u, delta->nodes()[0]->parent()->id());
+  CHECK_EQ(2u, delta->ticks().size());
+  unsigned ticks = 0;
+  for (auto node_ticks : delta->ticks()) ticks += node_ticks.second;
+  CHECK_EQ(2u, ticks);
+  CHECK_EQ(1u, delta->truncated_ticks_count());
+
+  delta.reset(profiles.TakeProfileDelta("continuous"));
+  CHECK_EQ(0u, delta->nodes().size());
+  CHECK_EQ(0u, delta->ticks().size());
+  CHECK_EQ(0u, delta->truncated_ticks_count());
+
+  CpuProfile* profile = profiles.StopProfiling("continuous");
+  CHECK_EQ(4u, profile->top_down()->nodes_count());
+  CHECK_EQ(0, profile->samples_count());
+
+  delete entry1;
+  delete entry2;
+  delete entry3;
+}
+
+
 static const ProfileNode* PickChild(const ProfileNode* parent,
                                     const char* name) {
   for (int i = 0; i < parent->children()->length(); ++i) {
@@ -0,0 +1,76 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compares named loads from dictionary-mode objects with loads from
+// fast-mode objects and with Map lookups for the same set of keys.
+
+new BenchmarkSuite('SlowObject', [1000], [
+  new Benchmark('SlowObject', false, false, 0, SlowObject, SlowObjectSetup)
+]);
+
+new BenchmarkSuite('FastObject', [1000], [
+  new Benchmark('FastObject', false, false, 0, FastObject, FastObjectSetup)
+]);
+
+new BenchmarkSuite('Map', [1000], [
+  new Benchmark('Map', false, false, 0, MapGet, MapSetup)
+]);
+
+var N = 1000;
+var obj;
+var map;
+
+
+function MakeObject() {
+  return {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8};
+}
+
+
+function SumObject(o) {
+  var sum = 0;
+  for (var i = 0; i < N; i++) {
+    sum += o.a + o.b + o.c + o.d + o.e + o.f + o.g + o.h;
+  }
+  return sum;
+}
+
+
+function SlowObjectSetup() {
+  obj = MakeObject();
+  // Deleting a property other than the last one normalizes the object.
+  delete obj.a;
+  obj.a = 1;
+}
+
+
+function SlowObject() {
+  if (SumObject(obj) != 36 * N) throw new Error('Bad result');
+}
+
+
+function FastObjectSetup() {
+  obj = MakeObject();
+}
+
+
+function FastObject() {
+  if (SumObject(obj) != 36 * N) throw new Error('Bad result');
+}
+
+
+function MapSetup() {
+  map = new Map();
+  var keys = ['a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'];
+  for (var i = 0; i < keys.length; i++) map.set(keys[i], i + 1);
+}
+
+
+function MapGet() {
+  var sum = 0;
+  for (var i = 0; i < N; i++) {
+    sum += map.get('a') + map.get('b') + map.get('c') + map.get('d') +
+           map.get('e') + map.get('f') + map.get('g') + map.get('h');
+  }
+  if (sum != 36 * N) throw new Error('Bad result');
+}
@@ -0,0 +1,81 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the bulk operations of typed arrays on large arrays.
+
+new BenchmarkSuite('Fill', [1000], [
+  new Benchmark('Fill', false, false, 0, Fill, Setup)
+]);
+
+new BenchmarkSuite('IndexOf', [1000], [
+  new Benchmark('IndexOf', false, false, 0, IndexOf, Setup)
+]);
+
+new BenchmarkSuite('SetConvert', [1000], [
+  new Benchmark('SetConvert', false, false, 0, SetConvert, Setup)
+]);
+
+new BenchmarkSuite('CopyWithin', [1000], [
+  new Benchmark('CopyWithin', false, false, 0, CopyWithin, Setup)
+]);
+
+new BenchmarkSuite('SortFloat64', [1000], [
+  new Benchmark('SortFloat64', false, false, 0, SortFloat64, Setup)
+]);
+
+new BenchmarkSuite('SortUint8', [1000], [
+  new Benchmark('SortUint8', false, false, 0, SortUint8, Setup)
+]);
+
+var N = 100000;
+var float64;
+var int32;
+var uint8;
+
+
+function Setup() {
+  float64 = new Float64Array(N);
+  int32 = new Int32Array(N);
+  uint8 = new Uint8Array(N);
+  for (var i = 0; i < N; i++) {
+    float64[i] = Math.sin(i) * 1e6;
+    int32[i] = i;
+    uint8[i] = i * 7;
+  }
+}
+
+
+function Fill() {
+  int32.fill(42);
+  float64.fill(1.5, 10, N - 10);
+  if (int32[N - 1] !== 42) throw new Error("Fill failed");
+}
+
+
+function IndexOf() {
+  if (int32.indexOf(N - 1) !== N - 1) throw new Error("IndexOf failed");
+  if (int32.lastIndexOf(0) !== 0) throw new Error("LastIndexOf failed");
+}
+
+
+function SetConvert() {
+  int32.set(float64);
+  uint8.set(int32.subarray(0, N / 2), N / 4);
+}
+
+
+function CopyWithin() {
+  float64.copyWithin(0, N / 2);
+  int32.copyWithin(N / 2, 0);
+}
+
+
+function SortFloat64() {
+  float64.sort();
+}
+
+
+function SortUint8() {
+  uint8.sort();
+}
@@ -0,0 +1,149 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests that Array.prototype.forEach, some and every behave like the generic
+// algorithm when the array changes under the fast paths.
+
+function collect(array) {
+  var seen = [];
+  array.forEach(function(v, i, o) {
+    assertSame(array, o);
+    seen.push(i, v);
+  });
+  return seen;
+}
+
+(function TestElementsKinds() {
+  assertEquals([0, 1, 1, 2], collect([1, 2]));
+  assertEquals([0, 1.5, 1, 2.5], collect([1.5, 2.5]));
+  assertEquals([0, "a", 1, null], collect(["a", null]));
+  assertEquals([0, 1, 2, 3], collect([1, , 3]));
+  assertEquals([0, 1.5, 2, 3.5], collect([1.5, , 3.5]));
+  assertEquals([1, "b"], collect([, "b", , ]));
+  assertEquals([], collect([]));
+})();
+
+(function TestHoleOnPrototype() {
+  Array.prototype[1] = "proto";
+  try {
+    assertEquals([0, 1, 1, "proto", 2, 3], collect([1, , 3]));
+    assertEquals([0, 1.5, 1, "proto", 2, 3.5], collect([1.5, , 3.5]));
+  } finally {
+    delete Array.prototype[1];
+  }
+})();
+
+(function TestTransitionDuringIteration() {
+  var array = [1, 2, 3, 4];
+  var seen = [];
+  array.forEach(function(v, i) {
+    seen.push(v);
+    if (i == 1) array[3] = 4.5;
+    if (i == 2) array[3] = "four";
+  });
+  assertEquals([1, 2, 3, "four"], seen);
+})();
+
+(function TestShrinkDuringIteration() {
+  var array = [1, 2, 3, 4];
+  var seen = [];
+  array.forEach(function(v, i) {
+    seen.push(v);
+    array.length = 2;
+  });
+  assertEquals([1, 2], seen);
+
+  array = [1, 2, 3, 4];
+  seen = [];
+  Array.prototype[3] = "proto";
+  try {
+    array.forEach(function(v) {
+      seen.push(v);
+      array.length = 1;
+    });
+  } finally {
+    delete Array.prototype[3];
+  }
+  assertEquals([1, "proto"], seen);
+})();
+
+(function TestGrowDuringIteration() {
+  var array = [1, 2];
+  var count = 0;
+  array.forEach(function(v) {
+    count++;
+    array.push(v);
+  });
+  assertEquals(2, count);
+  assertEquals([1, 2, 1, 2], array);
+})();
+
+(function TestDictionaryElements() {
+  var array = [];
+  array[100000] = 1;
+  array[3] = 0;
+  assertEquals([3, 0, 100000, 1], collect(array));
+})();
+
+(function TestArrayLike() {
+  var object = { length: 3, 0: "a", 2: "c" };
+  var seen = [];
+  Array.prototype.forEach.call(object, function(v, i) { seen.push(i, v); });
+  assertEquals([0, "a", 2, "c"], seen);
+
+  seen = [];
+  Array.prototype.forEach.call("ab", function(v) { seen.push(v); });
+  assertEquals(["a", "b"], seen);
+
+  var getter_calls = 0;
+  object = { get length() { getter_calls++; return 2; } };
+  Array.prototype.forEach.call(object, function() {});
+  assertEquals(1, getter_calls);
+})();
+
+(function TestSomeEvery() {
+  var array = [1, 2.5, , "x", {}];
+  var visited = [];
+  assertTrue(array.some(function(v, i) { visited.push(i); return v === "x"; }));
+  assertEquals([0, 1, 3], visited);
+  assertFalse(array.some(function(v) { return v === undefined; }));
+  assertTrue(array.every(function(v) { return v !== undefined; }));
+  visited = [];
+  assertFalse(array.every(function(v, i) { visited.push(i); return i < 1; }));
+  assertEquals([0, 1], visited);
+  assertFalse([].some(function() { return true; }));
+  assertTrue([].every(function() { return false; }));
+  // The result of the callback is converted with ToBoolean.
+  assertTrue([0].some(function() { return "yes"; }));
+  assertFalse([0].every(function() { return 0; }));
+})();
+
+(function TestThisArg() {
+  var receiver = {};
+  [1].forEach(function() { assertSame(receiver, this); }, receiver);
+  [1].some(function() { "use strict"; assertSame(undefined, this); });
+  [1].every(function() { "use strict"; assertSame(5, this); return true; }, 5);
+})();
+
+(function TestErrors() {
+  assertThrows(function() { Array.prototype.forEach.call(null, f); },
+               TypeError);
+  assertThrows(function() { Array.prototype.some.call(undefined, f); },
+               TypeError);
+  assertThrows(function() { [1].every(); }, TypeError);
+  assertThrows(function() { [1].forEach({}); }, TypeError);
+  // The length is read before the callback is checked.
+  var object = { get length() { throw new RangeError(); } };
+  assertThrows(function() { Array.prototype.forEach.call(object, null); },
+               RangeError);
+  function f() {}
+})();
+
+(function TestProperties() {
+  assertEquals(1, Array.prototype.forEach.length);
+  assertEquals(1, Array.prototype.some.length);
+  assertEquals(1, Array.prototype.every.length);
+  assertEquals("forEach", Array.prototype.forEach.name);
+  assertFalse(Array.prototype.propertyIsEnumerable("forEach"));
+})();
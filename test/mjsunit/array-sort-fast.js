@@ -0,0 +1,95 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests the native default-comparator sort of Smi and string arrays against
+// sorting with an equivalent comparator.
+
+function compareAsStrings(x, y) {
+  x = String(x);
+  y = String(y);
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+function check(array) {
+  var expected = array.slice().sort(compareAsStrings);
+  assertSame(array, array.sort());
+  assertEquals(expected, array);
+}
+
+(function TestSmis() {
+  check([]);
+  check([1]);
+  check([3, 1, 2]);
+  check([10, 9, 1, 100, -1, -10, 0, 2147483647, -2147483648, 1000000000,
+         999999999, 19, 91, 5]);
+  var array = [];
+  for (var i = 0; i < 1000; i++) array.push((i * 7919) % 1009 - 500);
+  check(array);
+})();
+
+(function TestStrings() {
+  check(["b", "a", "c", "", "ab", "aa", "ሴ", "ÿ", "B", "a\u0000"]);
+  var array = [];
+  for (var i = 0; i < 1000; i++) array.push("k" + ((i * 7919) % 1009));
+  check(array);
+  // Cons and sliced strings.
+  var long = "abcdefghijklmnopqrstuvwxyz";
+  check([long + "z", long.substring(1, 20), "x" + long, long]);
+})();
+
+(function TestUndefinedAndHoles() {
+  var array = [3, undefined, 1, , 2, undefined, , 0];
+  array.sort();
+  assertEquals(8, array.length);
+  assertEquals([0, 1, 2, 3, undefined, undefined], array.slice(0, 6));
+  assertFalse(6 in array);
+  assertFalse(7 in array);
+
+  array = ["b", , "a", undefined];
+  array.sort();
+  assertEquals(["a", "b", undefined], array.slice(0, 3));
+  assertFalse(3 in array);
+})();
+
+(function TestFallbacks() {
+  // Mixed element types, non-arrays and prototype elements take the generic
+  // path and must give the same results.
+  check([3, "2", 1, "10"]);
+  check([1.5, 10, 2, 0.5]);
+  check([{toString() { return "b"; }}, "a", "c"]);
+  var object = {length: 3, 0: "c", 1: "a", 2: "b"};
+  Array.prototype.sort.call(object);
+  assertEquals(["a", "b", "c"], [object[0], object[1], object[2]]);
+
+  Array.prototype[1] = "m";
+  try {
+    var array = ["z", , "a"];
+    array.sort();
+    assertEquals(["a", "m", "z"], array);
+  } finally {
+    delete Array.prototype[1];
+  }
+})();
+
+(function TestCopyOnWriteLiteral() {
+  function f() { return [3, 2, 1]; }
+  var array = f();
+  array.sort();
+  assertEquals([1, 2, 3], array);
+  assertEquals([3, 2, 1], f());
+})();
+
+(function TestNonCallableComparator() {
+  var array = [10, 9, 1];
+  array.sort(undefined);
+  assertEquals([1, 10, 9], array);
+})();
+
+(function TestLengthBeyondArrayIndices() {
+  // Lengths of array-like objects are not limited to 2^32 - 1 and must not
+  // reach the native sort.
+  var object = {length: 2 ** 32, 0: "b"};
+  assertSame(object, Array.prototype.sort.call(object));
+  assertEquals([1, 2, 3], Array.prototype.sort.call([3, 1, 2]));
+})();
@@ -0,0 +1,31 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --polymorphic-inlining
+// Flags: --max-inlined-nodes-cumulative=1
+
+// The targets only ever see small integers before optimization, so an
+// inlined copy would deoptimize the caller when it's passed a string.
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+
+// Polymorphic call site whose targets together exceed the inlining budget,
+// so it stays a regular call instead of being expanded to a dispatch.
+function dispatch(i, a, b) {
+  var f = (i & 1) ? sub : add;
+  return f(a, b);
+}
+
+for (var i = 0; i < 10; ++i) {
+  assertEquals(i & 1 ? 3 : 9, dispatch(i, 6, 3));
+}
+%OptimizeFunctionOnNextCall(dispatch);
+assertEquals(9, dispatch(0, 6, 3));
+assertEquals(3, dispatch(1, 6, 3));
+assertOptimized(dispatch);
+
+// Neither target was inlined.
+assertEquals("63", dispatch(0, "6", 3));
+assertEquals(3, dispatch(1, "6", 3));
+assertOptimized(dispatch);
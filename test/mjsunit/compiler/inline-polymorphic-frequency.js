@@ -0,0 +1,52 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --polymorphic-inlining
+// Flags: --min-inlining-frequency=0.15
+
+// The targets only ever see small integers before optimization, so an
+// inlined copy deoptimizes the caller when it's passed a string, while a
+// call to the unoptimized target just computes the result. This tells us
+// which of the call sites were inlined.
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+function mul(a, b) { return a * b; }
+
+// Polymorphic call site with a dispatch on two known targets.
+function dispatch(i, a, b) {
+  var f = (i & 1) ? sub : add;
+  return f(a, b);
+}
+
+// The call to mul is executed once in 100 invocations, which is below the
+// minimum frequency, while the call to add is executed every time.
+function rare(i, a, b) {
+  if (i == 50) return mul(a, b);
+  return add(a, b);
+}
+
+for (var i = 0; i < 100; ++i) {
+  assertEquals(i & 1 ? 3 : 9, dispatch(i, 6, 3));
+  assertEquals(i == 50 ? 18 : 9, rare(i, 6, 3));
+}
+%OptimizeFunctionOnNextCall(dispatch);
+%OptimizeFunctionOnNextCall(rare);
+assertEquals(9, dispatch(0, 6, 3));
+assertEquals(3, dispatch(1, 6, 3));
+assertEquals(9, rare(0, 6, 3));
+assertEquals(18, rare(50, 6, 3));
+assertOptimized(dispatch);
+assertOptimized(rare);
+
+// The rarely executed call to mul was not inlined.
+assertEquals(18, rare(50, "6", 3));
+assertOptimized(rare);
+
+// The frequently executed call to add was inlined.
+assertEquals("63", rare(0, "6", 3));
+assertUnoptimized(rare);
+
+// Both targets of the polymorphic call site were inlined.
+assertEquals("63", dispatch(0, "6", 3));
+assertUnoptimized(dispatch);
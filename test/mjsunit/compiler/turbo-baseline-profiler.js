@@ -0,0 +1,31 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --turbo --turbo-baseline
+// Flags: --max-opt-count=2 --no-always-opt --no-concurrent-recompilation
+
+function f(x, n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) sum += x;
+  return sum;
+}
+
+// Optimize and deoptimize {f} until optimization gets disabled because it
+// deoptimized too often.
+for (var i = 0; i < 4; i++) {
+  assertEquals(2, f(1, 2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(1, 2));
+  %DeoptimizeFunction(f);
+}
+assertEquals(8, %GetOptimizationStatus(f));  // Interpreted.
+
+// Once {f} is hot again, the runtime profiler gets it non-speculative code on
+// its own.
+for (var i = 0; i < 1000 && %GetOptimizationStatus(f) != 7; i++) {
+  assertEquals(2000, f(2, 1000));
+}
+assertEquals(7, %GetOptimizationStatus(f));  // TurboFan.
+assertEquals("0aa", f("a", 2));
+assertEquals(7, %GetOptimizationStatus(f));
@@ -0,0 +1,51 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --turbo --turbo-baseline
+// Flags: --max-opt-count=2 --no-always-opt
+
+function f(x) { return x + 1; }
+
+// Optimize and deoptimize {f} until optimization gets disabled because it
+// deoptimized too often.
+for (var i = 0; i < 4; i++) {
+  assertEquals(2, f(1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(1));
+  %DeoptimizeFunction(f);
+}
+assertEquals(8, %GetOptimizationStatus(f));  // Interpreted.
+
+// It can still get non-speculative code, which handles any input without
+// deoptimizing.
+%OptimizeFunctionOnNextCall(f);
+assertEquals(2, f(1));
+assertEquals(7, %GetOptimizationStatus(f));  // TurboFan.
+assertEquals("a1", f("a"));
+assertEquals(2.5, f(1.5));
+assertEquals("[object Object]1", f({}));
+assertEquals(7, %GetOptimizationStatus(f));
+
+// Dropping the code goes back to the interpreter, from where {f} gets
+// non-speculative code again.
+%DeoptimizeFunction(f);
+assertEquals(8, %GetOptimizationStatus(f));
+assertEquals("b1", f("b"));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(3, f(2));
+assertEquals(7, %GetOptimizationStatus(f));
+
+// Disabled functions are not inlined. Speculative code of a caller keeps
+// calling the non-speculative code, also after the caller deoptimized back
+// into the interpreter.
+function g(x) { return f(x) * 2; }
+g(1);
+g(2);
+%OptimizeFunctionOnNextCall(g);
+assertEquals(4, g(1));
+assertEquals(7, %GetOptimizationStatus(g));
+assertEquals(NaN, g("c"));
+assertEquals(8, %GetOptimizationStatus(g));
+assertEquals(6, g(2));
+assertEquals(7, %GetOptimizationStatus(f));
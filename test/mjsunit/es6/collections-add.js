@@ -0,0 +1,103 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests Map.prototype.set and Set.prototype.add.
+
+(function TestReturnsReceiver() {
+  var map = new Map();
+  var set = new Set();
+  assertSame(map, map.set(1, 2));
+  assertSame(map, map.set(1, 3));
+  assertSame(set, set.add(1));
+  assertSame(set, set.add(1));
+  assertEquals(1, map.size);
+  assertEquals(1, set.size);
+  assertEquals(3, map.get(1));
+})();
+
+(function TestNewObjectKeys() {
+  // These keys get their identity hash when they are first added.
+  var keys = [{}, [], function() {}, new Map(), Object.create(null)];
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < keys.length; i++) {
+    map.set(keys[i], i);
+    set.add(keys[i]);
+  }
+  for (var i = 0; i < keys.length; i++) {
+    assertEquals(i, map.get(keys[i]));
+    assertTrue(set.has(keys[i]));
+  }
+  assertEquals(keys.length, map.size);
+  assertEquals(keys.length, set.size);
+})();
+
+(function TestMinusZero() {
+  var map = new Map();
+  var set = new Set();
+  map.set(-0, "zero");
+  set.add(-0);
+  assertEquals("zero", map.get(0));
+  assertTrue(set.has(0));
+  assertTrue(Object.is(0, map.keys().next().value));
+  assertTrue(Object.is(0, set.values().next().value));
+  map.set(0, "other");
+  set.add(0);
+  assertEquals(1, map.size);
+  assertEquals(1, set.size);
+  assertEquals("other", map.get(-0));
+})();
+
+(function TestGrow() {
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < 1000; i++) {
+    map.set(i, i * 2);
+    map.set("s" + i, i);
+    set.add(i);
+    set.add(i + 0.5);
+  }
+  assertEquals(2000, map.size);
+  assertEquals(2000, set.size);
+  for (var i = 0; i < 1000; i++) {
+    assertEquals(i * 2, map.get(i));
+    assertEquals(i, map.get("s" + i));
+    assertTrue(set.has(i));
+    assertTrue(set.has(i + 0.5));
+  }
+})();
+
+(function TestOrderAfterDelete() {
+  var map = new Map([[1, "a"], [2, "b"], [3, "c"]]);
+  var set = new Set([1, 2, 3]);
+  map.delete(2);
+  set.delete(2);
+  map.set(2, "d");
+  map.set(1, "e");
+  set.add(2);
+  set.add(1);
+  assertEquals([[1, "e"], [3, "c"], [2, "d"]], Array.from(map));
+  assertEquals([1, 3, 2], Array.from(set));
+})();
+
+(function TestIncompatibleReceiver() {
+  var receivers = [undefined, null, 1, "map", {}, new Set(), new WeakMap()];
+  for (var i = 0; i < receivers.length; i++) {
+    assertThrows(function() { Map.prototype.set.call(receivers[i], 1, 2); },
+                 TypeError);
+  }
+  assertThrows(function() { Set.prototype.add.call(new Map(), 1); },
+               TypeError);
+})();
+
+(function TestProperties() {
+  assertEquals(2, Map.prototype.set.length);
+  assertEquals(1, Set.prototype.add.length);
+  assertEquals("set", Map.prototype.set.name);
+  assertEquals("add", Set.prototype.add.name);
+  var desc = Object.getOwnPropertyDescriptor(Set.prototype, "add");
+  assertFalse(desc.enumerable);
+  assertTrue(desc.writable);
+  assertTrue(desc.configurable);
+})();
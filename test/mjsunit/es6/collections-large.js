@@ -0,0 +1,82 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the bucket chains of Map and Set with enough keys of different
+// kinds to span several rehashes, and check that lookups, deletions and
+// iteration order stay consistent.
+
+function MakeKeys(n) {
+  var keys = [];
+  for (var i = 0; i < n; i++) {
+    switch (i % 4) {
+      case 0: keys.push(i); break;
+      case 1: keys.push("k" + i); break;
+      case 2: keys.push({ id: i }); break;
+      case 3: keys.push(i + 0.5); break;
+    }
+  }
+  return keys;
+}
+
+(function TestMap() {
+  var keys = MakeKeys(5000);
+  var map = new Map();
+  for (var i = 0; i < keys.length; i++) map.set(keys[i], i);
+  assertEquals(keys.length, map.size);
+  for (var i = 0; i < keys.length; i++) {
+    assertTrue(map.has(keys[i]));
+    assertEquals(i, map.get(keys[i]));
+  }
+  assertFalse(map.has("k0"));
+  assertFalse(map.has({ id: 2 }));
+  assertFalse(map.has(0.25));
+
+  for (var i = 0; i < keys.length; i += 2) assertTrue(map.delete(keys[i]));
+  assertEquals(keys.length / 2, map.size);
+  for (var i = 0; i < keys.length; i++) {
+    assertEquals(i % 2 == 1, map.has(keys[i]));
+  }
+
+  var expected = 1;
+  map.forEach(function(value, key) {
+    assertEquals(expected, value);
+    assertSame(keys[expected], key);
+    expected += 2;
+  });
+  assertEquals(keys.length + 1, expected);
+
+  // Re-adding appends to the end of the iteration order.
+  map.set(keys[0], "again");
+  var last;
+  for (var entry of map) last = entry;
+  assertSame(keys[0], last[0]);
+  assertEquals("again", last[1]);
+})();
+
+(function TestSet() {
+  var keys = MakeKeys(5000);
+  var set = new Set(keys);
+  assertEquals(keys.length, set.size);
+  for (var i = 0; i < keys.length; i++) assertTrue(set.has(keys[i]));
+  for (var i = 0; i < keys.length; i += 3) assertTrue(set.delete(keys[i]));
+  for (var i = 0; i < keys.length; i++) {
+    assertEquals(i % 3 != 0, set.has(keys[i]));
+  }
+  var i = 1;
+  for (var key of set) {
+    if (i % 3 == 0) i++;
+    assertSame(keys[i++], key);
+  }
+})();
+
+(function TestSpecialKeys() {
+  var map = new Map();
+  for (var i = 0; i < 100; i++) map.set(i, i);
+  map.set(NaN, "nan");
+  map.set(-0, "zero");
+  assertEquals("nan", map.get(NaN));
+  assertEquals("nan", map.get(0 / 0));
+  assertEquals("zero", map.get(0));
+  assertTrue(map.has(-0));
+})();
@@ -0,0 +1,91 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests Map.prototype.get, Map.prototype.has and Set.prototype.has.
+
+(function TestKeys() {
+  var object = {};
+  var symbol = Symbol("symbol");
+  var keys = [0, 1, -1, 1 << 30, 1.5, NaN, Infinity, "", "a", "ab" + "cd",
+              true, false, null, undefined, object, [], function() {},
+              symbol];
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < keys.length; i++) {
+    map.set(keys[i], i);
+    set.add(keys[i]);
+  }
+  for (var i = 0; i < keys.length; i++) {
+    assertEquals(i, map.get(keys[i]));
+    assertTrue(map.has(keys[i]));
+    assertTrue(set.has(keys[i]));
+  }
+  // Strings are compared by value, heap numbers by SameValueZero.
+  var abcd = "abc";
+  abcd += "d";
+  assertEquals(9, map.get(abcd));
+  assertTrue(set.has(abcd));
+  assertEquals(4, map.get(3 / 2));
+  assertEquals(5, map.get(0 / 0));
+  assertEquals(0, map.get(-0));
+  assertTrue(map.has(-0));
+  assertTrue(set.has(-0));
+  assertEquals(1, map.get(1.0));
+})();
+
+(function TestMissingKeys() {
+  var map = new Map([[1, "one"], ["x", "ex"], [{}, "object"]]);
+  var set = new Set([1, "x", {}]);
+  var missing = [2, 1.25, "y", {}, [], Symbol(), NaN, undefined];
+  for (var i = 0; i < missing.length; i++) {
+    assertEquals(undefined, map.get(missing[i]));
+    assertFalse(map.has(missing[i]));
+    assertFalse(set.has(missing[i]));
+  }
+  assertEquals(undefined, map.get());
+  assertFalse(map.has());
+  assertFalse(set.has());
+})();
+
+(function TestDeletedKeys() {
+  var map = new Map();
+  var set = new Set();
+  for (var i = 0; i < 100; i++) {
+    map.set(i, i);
+    set.add(i);
+  }
+  for (var i = 0; i < 100; i += 2) {
+    map.delete(i);
+    set.delete(i);
+  }
+  for (var i = 0; i < 100; i++) {
+    assertEquals(i % 2 == 0 ? undefined : i, map.get(i));
+    assertEquals(i % 2 != 0, map.has(i));
+    assertEquals(i % 2 != 0, set.has(i));
+  }
+})();
+
+(function TestIncompatibleReceiver() {
+  var receivers = [undefined, null, 1, "map", {}, new Set(), new WeakMap()];
+  for (var i = 0; i < receivers.length; i++) {
+    assertThrows(function() { Map.prototype.get.call(receivers[i], 1); },
+                 TypeError);
+    assertThrows(function() { Map.prototype.has.call(receivers[i], 1); },
+                 TypeError);
+  }
+  assertThrows(function() { Set.prototype.has.call(new Map(), 1); },
+               TypeError);
+})();
+
+(function TestProperties() {
+  assertEquals(1, Map.prototype.get.length);
+  assertEquals(1, Map.prototype.has.length);
+  assertEquals(1, Set.prototype.has.length);
+  assertEquals("get", Map.prototype.get.name);
+  assertEquals("has", Set.prototype.has.name);
+  var desc = Object.getOwnPropertyDescriptor(Map.prototype, "get");
+  assertFalse(desc.enumerable);
+  assertTrue(desc.writable);
+  assertTrue(desc.configurable);
+})();
@@ -0,0 +1,194 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  Float32Array,
+  Float64Array
+];
+
+function toArray(array) {
+  return Array.prototype.slice.call(array);
+}
+
+// Converts {values} like storing them one by one into a {constructor}.
+function convert(constructor, values) {
+  var array = new constructor(values.length);
+  for (var i = 0; i < values.length; i++) array[i] = values[i];
+  return toArray(array);
+}
+
+var values = [0, -0, 1, -1, 1.5, -1.5, 2.5, 127, 128, 255, 256, -129, 65535,
+              65536, -32769, 2147483647, 2147483648, 4294967295, 4294967296,
+              1e20, -1e20, 0.1, NaN, Infinity, -Infinity];
+
+(function TestSetWithConversion() {
+  for (var source of typedArrayConstructors) {
+    for (var target of typedArrayConstructors) {
+      var s = new source(values);
+      var t = new target(values.length + 2);
+      t.set(s, 1);
+      var expected = [0].concat(convert(target, toArray(s)), [0]);
+      assertEquals(expected, toArray(t), source.name + " -> " + target.name);
+    }
+  }
+})();
+
+(function TestSetOverlapping() {
+  var buffer = new ArrayBuffer(64);
+  var bytes = new Uint8Array(buffer);
+  for (var i = 0; i < 64; i++) bytes[i] = i;
+  var source = new Uint8Array(buffer, 0, 16);
+  var expected = toArray(source);
+  // The target overlaps the source and grows element-wise.
+  var target = new Uint32Array(buffer, 4, 15);
+  target.set(source, 0);
+  assertEquals(expected.slice(0, 15), toArray(target));
+
+  for (var i = 0; i < 64; i++) bytes[i] = i;
+  var wide = new Uint16Array(buffer, 16, 8);
+  expected = toArray(wide);
+  var narrow = new Uint8Array(buffer, 18, 16);
+  narrow.set(wide, 2);
+  assertEquals(convert(Uint8Array, expected), toArray(narrow).slice(2, 10));
+})();
+
+(function TestFill() {
+  for (var constructor of typedArrayConstructors) {
+    for (var value of values) {
+      var array = new constructor(5);
+      array.fill(value, 1, -1);
+      assertEquals([0].concat(convert(constructor, [value, value, value]), [0]),
+                   toArray(array), constructor.name + " " + value);
+    }
+    var array = new constructor(4);
+    assertSame(array, array.fill("3"));
+    assertEquals(convert(constructor, [3, 3, 3, 3]), toArray(array));
+    array.fill(7, 10);
+    array.fill(7, 2, 1);
+    array.fill(7, -2, -10);
+    assertEquals(convert(constructor, [3, 3, 3, 3]), toArray(array));
+  }
+
+  // The value is converted once, before the indices.
+  var log = [];
+  var value = { valueOf() { log.push("value"); return 9; } };
+  var start = { valueOf() { log.push("start"); return 1; } };
+  var array = new Int32Array(3);
+  array.fill(value, start);
+  assertEquals(["value", "start"], log);
+  assertEquals([0, 9, 9], toArray(array));
+})();
+
+(function TestFillNeutered() {
+  var array = new Int32Array(4);
+  var end = { valueOf() { %ArrayBufferNeuter(array.buffer); return 4; } };
+  assertSame(array, array.fill(1, 0, end));
+  assertEquals(0, array.length);
+})();
+
+(function TestIndexOf() {
+  for (var constructor of typedArrayConstructors) {
+    var array = new constructor([1, 2, 3, 2, 1, 0]);
+    assertEquals(1, array.indexOf(2));
+    assertEquals(3, array.indexOf(2, 2));
+    assertEquals(3, array.indexOf(2, -3));
+    assertEquals(-1, array.indexOf(2, 10));
+    assertEquals(5, array.indexOf(-0));
+    assertEquals(-1, array.indexOf("2"));
+    assertEquals(-1, array.indexOf(1.5));
+    assertEquals(-1, array.indexOf(NaN));
+    assertEquals(3, array.lastIndexOf(2));
+    assertEquals(1, array.lastIndexOf(2, 2));
+    assertEquals(1, array.lastIndexOf(2, -4));
+    assertEquals(-1, array.lastIndexOf(2, -10));
+    assertEquals(4, array.lastIndexOf(1, 100));
+    assertEquals(5, array.lastIndexOf(0));
+    assertEquals(-1, array.lastIndexOf(NaN));
+    assertEquals(-1, new constructor(0).indexOf(0));
+    assertEquals(-1, new constructor(0).lastIndexOf(0));
+  }
+  assertEquals(1, new Float32Array([0, Infinity]).indexOf(Infinity));
+  assertEquals(-1, new Float32Array([0.1]).indexOf(0.1));
+  assertEquals(0, new Float32Array([0.5]).lastIndexOf(0.5));
+  assertEquals(-1, new Uint8Array([255]).indexOf(-1));
+  assertEquals(-1, new Int8Array([-1]).lastIndexOf(255));
+})();
+
+(function TestIndexOfLargeFromIndex() {
+  // Start indices beyond the array index range must not reach the runtime.
+  for (var constructor of typedArrayConstructors) {
+    var array = new constructor(4);
+    assertEquals(-1, array.indexOf(0, 4));
+    assertEquals(-1, array.indexOf(0, 5));
+    assertEquals(-1, array.indexOf(0, 2 ** 32 - 1));
+    assertEquals(-1, array.indexOf(0, 2 ** 32));
+    assertEquals(-1, array.indexOf(0, 2 ** 53));
+    assertEquals(-1, array.indexOf(0, Infinity));
+    assertEquals(0, array.indexOf(0, -Infinity));
+    assertEquals(3, array.lastIndexOf(0, Infinity));
+    assertEquals(3, array.lastIndexOf(0, 2 ** 32));
+    assertEquals(-1, array.lastIndexOf(0, -Infinity));
+  }
+})();
+
+(function TestCopyWithin() {
+  for (var constructor of typedArrayConstructors) {
+    var array = new constructor([1, 2, 3, 4, 5]);
+    assertSame(array, array.copyWithin(0, 3));
+    assertEquals(convert(constructor, [4, 5, 3, 4, 5]), toArray(array));
+    array = new constructor([1, 2, 3, 4, 5]);
+    array.copyWithin(1, 0, 3);
+    assertEquals(convert(constructor, [1, 1, 2, 3, 5]), toArray(array));
+    array = new constructor([1, 2, 3, 4, 5]);
+    array.copyWithin(-2, -4, -3);
+    assertEquals(convert(constructor, [1, 2, 3, 2, 5]), toArray(array));
+    array.copyWithin(0, 3, 1);
+    assertEquals(convert(constructor, [1, 2, 3, 2, 5]), toArray(array));
+  }
+})();
+
+(function TestSort() {
+  for (var constructor of typedArrayConstructors) {
+    var array = new constructor(values);
+    var expected = toArray(array).sort(function(x, y) {
+      if (x < y) return -1;
+      if (x > y) return 1;
+      if (x === 0 && y === 0) {
+        if (1 / x < 1 / y) return -1;
+        return 1 / x > 1 / y ? 1 : 0;
+      }
+      if (isNaN(x)) return isNaN(y) ? 0 : 1;
+      if (isNaN(y)) return -1;
+      return 0;
+    });
+    assertSame(array, array.sort());
+    assertEquals(expected, toArray(array), constructor.name);
+  }
+  var floats = new Float64Array([NaN, 0, -0, -Infinity, 3, NaN, -0, 0]);
+  floats.sort();
+  assertEquals(-Infinity, floats[0]);
+  assertEquals(-Infinity, 1 / floats[1]);
+  assertEquals(-Infinity, 1 / floats[2]);
+  assertEquals(Infinity, 1 / floats[3]);
+  assertEquals(Infinity, 1 / floats[4]);
+  assertEquals(3, floats[5]);
+  assertTrue(isNaN(floats[6]) && isNaN(floats[7]));
+
+  var bytes = new Int8Array([5, -128, 127, 0, -1, 5]);
+  bytes.sort();
+  assertEquals([-128, -1, 0, 5, 5, 127], toArray(bytes));
+
+  // A comparator still takes precedence.
+  bytes.sort(function(x, y) { return y - x; });
+  assertEquals([127, 5, 5, 0, -1, -128], toArray(bytes));
+})();
@@ -0,0 +1,39 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-sharedarraybuffer
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  Float32Array,
+  Float64Array
+];
+
+(function TestSortSharedTypedArray() {
+  for (var constructor of typedArrayConstructors) {
+    var length = 100;
+    var buffer =
+        new SharedArrayBuffer(length * constructor.BYTES_PER_ELEMENT);
+    var array = new constructor(buffer);
+    for (var i = 0; i < length; i++) array[i] = (i * 37) % length;
+    assertSame(array, array.sort());
+    for (var i = 0; i < length; i++) {
+      assertEquals(i, array[i], constructor.name);
+    }
+  }
+
+  // Views into a shared buffer only sort their own elements.
+  var buffer = new SharedArrayBuffer(16);
+  var bytes = new Uint8Array(buffer);
+  bytes.set([9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10]);
+  new Uint8Array(buffer, 4, 8).sort();
+  assertEquals([9, 8, 7, 6, 0, 1, 2, 3, 4, 5, 14, 15, 13, 12, 11, 10],
+               Array.prototype.slice.call(bytes));
+})();
@@ -0,0 +1,20 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --ignition-osr --concurrent-osr
+// Flags: --function-context-specialization --no-always-opt
+
+// Function context specialized code cannot be cached in the optimized code
+// map, so OSR compiles it synchronously and enters it at the next back edge.
+function f() {
+  var entered = -1;
+  for (var i = 0; i < 100; i++) {
+    if (i == 11) %OptimizeOsr();
+    if (entered < 0 && %RunningInOptimizedCode()) entered = i;
+  }
+  return entered;
+}
+
+assertEquals(12, f());
+assertEquals(1, %GetOptimizationCount(f));
@@ -0,0 +1,44 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --ignition-osr --concurrent-osr
+// Flags: --block-concurrent-recompilation --no-always-opt
+
+// Keeps looping until the OSR code has been installed, and then for another
+// {n} iterations, so that a later back edge enters it. The iteration that
+// first runs in the OSR code is kept in {entered}.
+var entered;
+function f(first, n) {
+  var sum = 0;
+  var installed = -1;
+  entered = -1;
+  for (var i = 0; installed < 0 || i < installed + n; i++) {
+    sum += i;
+    if (i == 11) %OptimizeOsr();
+    if (first && i == 22) {
+      // The OSR job is blocked, meanwhile the loop kept interpreting.
+      assertEquals(0, %GetOptimizationCount(f));
+      %UnblockConcurrentRecompilation();
+    }
+    if (installed < 0 && %GetOptimizationCount(f) > 0) installed = i;
+    if (entered < 0 && %RunningInOptimizedCode()) entered = i;
+  }
+  assertEquals(i * (i - 1) / 2, sum);
+  return installed;
+}
+
+// The first run queues the OSR job and keeps interpreting until the code has
+// been compiled and installed.
+var installed = f(true, 100);
+assertTrue(installed > 22);
+assertTrue(entered > installed);
+assertEquals(1, %GetOptimizationCount(f));
+
+// Later runs find the code in the optimized code map and don't compile again.
+// They enter it right after the back edges have been armed.
+for (var i = 0; i < 3; i++) {
+  assertEquals(0, f(false, 100));
+  assertTrue(entered > 11);
+}
+assertEquals(1, %GetOptimizationCount(f));
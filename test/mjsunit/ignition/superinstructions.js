@@ -0,0 +1,21 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --turbo --ignition-superinstructions
+
+function add(a, b) {
+  var c = a + b;
+  return c + a;
+}
+
+assertEquals(7, add(2, 3));
+assertEquals("xyx", add("x", "y"));
+assertEquals(3.5, add(1.25, 1));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(7, add(2, 3));
+
+// Lazy deopt in the middle of the fused addition.
+var o = { valueOf: function() { %DeoptimizeFunction(add); return 10; } };
+assertEquals(21, add(o, 1));
+assertEquals(7, add(2, 3));
@@ -0,0 +1,65 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test dictionary load ICs, which cache the dictionary entry of the property
+// and have to fall back to a full lookup when the entry moves.
+
+function load(o) { return o.x; }
+function keyedLoad(o, key) { return o[key]; }
+
+function makeSlow() {
+  var o = { x: 1, y: 2, z: 3 };
+  delete o.y;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+(function TestLoad() {
+  var o = makeSlow();
+  for (var i = 0; i < 5; i++) {
+    assertEquals(1, load(o));
+    assertEquals(3, keyedLoad(o, "z"));
+  }
+})();
+
+(function TestEntryMoves() {
+  var o = makeSlow();
+  for (var i = 0; i < 5; i++) assertEquals(1, load(o));
+  // Delete and re-add the property, and grow the dictionary so that it is
+  // rehashed. The cached entry no longer holds the key.
+  delete o.x;
+  assertEquals(undefined, load(o));
+  for (var i = 0; i < 100; i++) o["p" + i] = i;
+  o.x = 42;
+  assertEquals(42, load(o));
+  for (var i = 0; i < 100; i += 10) {
+    assertEquals(i, keyedLoad(o, "p" + i));
+  }
+})();
+
+(function TestAccessor() {
+  var o = makeSlow();
+  for (var i = 0; i < 5; i++) assertEquals(1, load(o));
+  // Redefining the property does not change the map of a slow object.
+  Object.defineProperty(o, "x", { get: function() { return 7; } });
+  assertFalse(%HasFastProperties(o));
+  assertEquals(7, load(o));
+})();
+
+(function TestPolymorphic() {
+  var objects = [];
+  for (var i = 0; i < 3; i++) {
+    var o = makeSlow();
+    o["q" + i] = i;
+    o.x = i;
+    objects.push(o);
+  }
+  for (var round = 0; round < 5; round++) {
+    for (var i = 0; i < objects.length; i++) {
+      assertEquals(i, load(objects[i]));
+    }
+  }
+})();
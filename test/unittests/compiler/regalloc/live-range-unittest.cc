@@ -429,6 +429,32 @@ TEST_F(LiveRangeUnitTest, IDGeneration) {
   EXPECT_EQ(1, splinter->relative_id());
 }
 
+TEST_F(LiveRangeUnitTest, MergeSpillRangesInStartOrder) {
+  // Merging each range into the first disjoint one in virtual register order
+  // puts {0, 2} together and needs three slots. In start order, {0, 3} and
+  // {1, 2} share slots and two suffice.
+  TopLevelLiveRange* ranges[] = {
+      TestRangeBuilder(zone()).Id(0).Build(0, 4),
+      TestRangeBuilder(zone()).Id(1).Build(0, 10),
+      TestRangeBuilder(zone()).Id(2).Build(12, 18),
+      TestRangeBuilder(zone()).Id(3).Build(6, 18)};
+  ZoneVector<SpillRange*> spill_ranges(zone());
+  for (TopLevelLiveRange* range : ranges) {
+    spill_ranges.push_back(new (zone()) SpillRange(range, zone()));
+    range->set_spill_type(TopLevelLiveRange::SpillType::kSpillRange);
+  }
+
+  OperandAssigner::MergeSpillRanges(spill_ranges, zone());
+
+  int slot_count = 0;
+  for (SpillRange* spill_range : spill_ranges) {
+    if (!spill_range->IsEmpty()) slot_count++;
+  }
+  EXPECT_EQ(2, slot_count);
+  EXPECT_EQ(ranges[0]->GetSpillRange(), ranges[3]->GetSpillRange());
+  EXPECT_EQ(ranges[1]->GetSpillRange(), ranges[2]->GetSpillRange());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <set>
+
 #include "src/compiler/pipeline.h"
 #include "test/unittests/compiler/instruction-sequence-unittest.h"
 
@@ -684,6 +686,43 @@ TEST_F(RegisterAllocatorTest, MultipleDeferredBlockSpills) {
             GetParallelMoveCount(start_of_b3, Instruction::START, sequence()));
 }
 
+TEST_F(RegisterAllocatorTest, DisjointSpillRangesShareSlot) {
+  // Each value is live across a call, which clobbers all registers and thus
+  // forces it onto the stack. The values are never live at the same time, so
+  // all of them fit into a single spill slot.
+  const int kValueCount = 4;
+  StartBlock();
+  for (int i = 0; i < kValueCount; ++i) {
+    auto value = EmitOI(Reg());
+    EmitCall(Slot(-1));
+    EmitI(Reg(value));
+  }
+  EndBlock(Last());
+
+  Allocate();
+
+  std::set<int> spill_slots;
+  for (const Instruction* instr : sequence()->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; ++i) {
+      const ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (const MoveOperands* move : *moves) {
+        if (move->IsEliminated() || move->IsRedundant()) continue;
+        for (const InstructionOperand& op :
+             {move->source(), move->destination()}) {
+          if (!op.IsStackSlot()) continue;
+          int index = LocationOperand::cast(op).index();
+          // Negative indices denote incoming parameters and call results.
+          if (index >= 0) spill_slots.insert(index);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(1u, spill_slots.size());
+}
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
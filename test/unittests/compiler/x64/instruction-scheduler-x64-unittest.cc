@@ -0,0 +1,93 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Gives the tests access to the x64 machine model of the scheduler. The
+// instructions are built before register allocation, like the scheduler
+// sees them.
+class InstructionSchedulerTester {
+ public:
+  explicit InstructionSchedulerTester(Zone* zone)
+      : zone_(zone), scheduler_(zone, nullptr) {}
+
+  Instruction* Emit(InstructionCode opcode, size_t input_count) {
+    InstructionOperand output =
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+    InstructionOperand inputs[] = {
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1),
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2)};
+    return Instruction::New(zone_, opcode, 1, &output, input_count, inputs, 0,
+                            nullptr);
+  }
+
+  int GetFlags(const Instruction* instr) const {
+    return scheduler_.GetTargetInstructionFlags(instr);
+  }
+
+  static int GetLatency(const Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+
+ private:
+  Zone* zone_;
+  InstructionScheduler scheduler_;
+};
+
+class InstructionSchedulerX64Test : public TestWithZone {
+ public:
+  InstructionSchedulerX64Test() : tester_(zone()) {}
+
+ protected:
+  int load_latency() const { return CpuFeatures::IsSupported(ATOM) ? 3 : 4; }
+
+  InstructionSchedulerTester tester_;
+};
+
+TEST_F(InstructionSchedulerX64Test, RegisterMoves) {
+  const ArchOpcode kMoves[] = {kX64Movl, kX64Movsxbl, kX64Movzxwl,
+                               kX64Movsxlq};
+  for (ArchOpcode opcode : kMoves) {
+    Instruction* instr = tester_.Emit(opcode, 1);
+    EXPECT_EQ(kNoOpcodeFlags, tester_.GetFlags(instr));
+    EXPECT_EQ(1, InstructionSchedulerTester::GetLatency(instr));
+  }
+}
+
+TEST_F(InstructionSchedulerX64Test, Loads) {
+  const ArchOpcode kLoads[] = {kX64Movl, kX64Movsxbl, kX64Movzxwl,
+                               kX64Movsxlq};
+  for (ArchOpcode opcode : kLoads) {
+    Instruction* instr =
+        tester_.Emit(opcode | AddressingModeField::encode(kMode_MRI), 1);
+    EXPECT_EQ(kIsLoadOperation, tester_.GetFlags(instr));
+    EXPECT_EQ(load_latency(), InstructionSchedulerTester::GetLatency(instr));
+  }
+}
+
+TEST_F(InstructionSchedulerX64Test, MemoryOperandArithmetic) {
+  Instruction* add = tester_.Emit(kX64Add32, 2);
+  EXPECT_EQ(1, InstructionSchedulerTester::GetLatency(add));
+  Instruction* add_from_memory =
+      tester_.Emit(kX64Add32 | AddressingModeField::encode(kMode_MR), 2);
+  EXPECT_EQ(load_latency() + 1,
+            InstructionSchedulerTester::GetLatency(add_from_memory));
+}
+
+TEST_F(InstructionSchedulerX64Test, Divisions) {
+  Instruction* idiv = tester_.Emit(kX64Idiv32, 2);
+  Instruction* imul = tester_.Emit(kX64Imul32, 2);
+  EXPECT_LT(InstructionSchedulerTester::GetLatency(imul),
+            InstructionSchedulerTester::GetLatency(idiv));
+  EXPECT_EQ(kMayNeedDeoptCheck, tester_.GetFlags(idiv));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -506,5 +506,98 @@ TEST_F(RuntimeCallStatsTest, NestedScopes) {
   EXPECT_IN_RANGE(100, counter3()->time().InMilliseconds(), 100 + kEpsilonMs);
 }
 
+TEST(RuntimeCallHistogramTest, Buckets) {
+  const int kSubBucketCount = RuntimeCallHistogram::kSubBucketCount;
+  int64_t lower_bound = 0;
+  for (int i = 0; i < RuntimeCallHistogram::kBucketCount; i++) {
+    int64_t upper_bound = RuntimeCallHistogram::BucketUpperBound(i);
+    EXPECT_LE(lower_bound, upper_bound);
+    EXPECT_EQ(i, RuntimeCallHistogram::BucketIndex(lower_bound));
+    EXPECT_EQ(i, RuntimeCallHistogram::BucketIndex(upper_bound));
+    // Buckets are at most 1 / kSubBucketCount of their values wide.
+    EXPECT_LE((upper_bound - lower_bound) * kSubBucketCount,
+              Max(lower_bound, static_cast<int64_t>(kSubBucketCount)));
+    lower_bound = upper_bound + 1;
+  }
+  EXPECT_EQ(static_cast<int64_t>(1) << RuntimeCallHistogram::kMaxValueBits,
+            lower_bound);
+}
+
+TEST(RuntimeCallHistogramTest, Percentiles) {
+  RuntimeCallHistogram histogram;
+  EXPECT_EQ(0, histogram.ValueAtPercentile(50));
+  for (int i = 1; i <= 100; i++) {
+    histogram.AddSample(base::TimeDelta::FromMicroseconds(i * 10));
+  }
+  EXPECT_EQ(100, histogram.count());
+  EXPECT_EQ(50500, histogram.total().InMicroseconds());
+  EXPECT_EQ(1000, histogram.max());
+  EXPECT_IN_RANGE(500, histogram.ValueAtPercentile(50), 500 + 500 / 8);
+  EXPECT_IN_RANGE(900, histogram.ValueAtPercentile(90), 900 + 900 / 8);
+  EXPECT_EQ(1000, histogram.ValueAtPercentile(100));
+  histogram.AddSample(base::TimeDelta::FromHours(24));
+  EXPECT_EQ((static_cast<int64_t>(1) << RuntimeCallHistogram::kMaxValueBits) -
+                1,
+            histogram.max());
+  histogram.Reset();
+  EXPECT_EQ(0, histogram.count());
+  EXPECT_EQ(0, histogram.ValueAtPercentile(99));
+}
+
+TEST_F(RuntimeCallStatsTest, Histograms) {
+  stats()->SetHistogramSamplingInterval(1);
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(50);
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      Sleep(100);
+    }
+  }
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(100);
+  }
+  RuntimeCallHistogram* histogram = counter()->histogram();
+  ASSERT_NE(nullptr, histogram);
+  EXPECT_EQ(2, histogram->count());
+  EXPECT_IN_RANGE(50, histogram->ValueAtPercentile(50) / 1000,
+                  50 + kEpsilonMs);
+  EXPECT_IN_RANGE(100, histogram->max() / 1000, 100 + kEpsilonMs);
+  EXPECT_EQ(1, counter2()->histogram()->count());
+  EXPECT_EQ(nullptr, counter3()->histogram());
+
+  // The histograms are kept when the counters are reset for tracing.
+  stats()->Reset();
+  EXPECT_EQ(2, counter()->histogram()->count());
+  stats()->ResetHistograms();
+  EXPECT_EQ(0, counter()->histogram()->count());
+  stats()->SetHistogramSamplingInterval(0);
+}
+
+TEST_F(RuntimeCallStatsTest, SampledHistograms) {
+  FLAG_runtime_stats = 0;
+  stats()->SetHistogramSamplingInterval(3);
+  // Histograms are enabled per RuntimeCallStats, not through the flag.
+  EXPECT_EQ(0, FLAG_runtime_stats);
+  EXPECT_TRUE(RuntimeCallStats::IsEnabled(stats()));
+  for (int i = 0; i < 9; i++) {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      CHANGE_CURRENT_RUNTIME_COUNTER(stats(), TestCounter3);
+    }
+  }
+  // Only every third outermost call is timed, with all of its nested calls.
+  EXPECT_EQ(3, counter()->count());
+  EXPECT_EQ(3, counter()->histogram()->count());
+  EXPECT_EQ(0, counter2()->count());
+  EXPECT_EQ(3, counter3()->count());
+  EXPECT_EQ(3, counter3()->histogram()->count());
+  EXPECT_EQ(nullptr, stats()->current_timer());
+  stats()->SetHistogramSamplingInterval(0);
+  EXPECT_FALSE(RuntimeCallStats::IsEnabled(stats()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -185,6 +185,42 @@ TEST_F(GCTracerTest, IncrementalScope) {
       200.0, tracer->current_.scopes[GCTracer::Scope::MC_INCREMENTAL_FINALIZE]);
 }
 
+TEST_F(GCTracerTest, PauseHistograms) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  const int kMarkCompactIndex =
+      GCTracer::Scope::NUMBER_OF_SCOPES + GCTracer::Event::MARK_COMPACTOR;
+  // Incremental samples are pauses of their own.
+  tracer->AddScopeSample(GCTracer::Scope::MC_INCREMENTAL_FINALIZE, 5);
+  tracer->AddScopeSample(GCTracer::Scope::MC_INCREMENTAL_FINALIZE, 7);
+  for (int i = 0; i < 2; i++) {
+    tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                  "collector unittest");
+    tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 100);
+    tracer->Stop(MARK_COMPACTOR);
+  }
+  RuntimeCallHistogram* histogram =
+      tracer->pause_histogram(GCTracer::Scope::MC_INCREMENTAL_FINALIZE);
+  ASSERT_NE(nullptr, histogram);
+  EXPECT_EQ(2, histogram->count());
+  EXPECT_EQ(12000, histogram->total().InMicroseconds());
+  histogram = tracer->pause_histogram(GCTracer::Scope::MC_MARK);
+  ASSERT_NE(nullptr, histogram);
+  EXPECT_EQ(2, histogram->count());
+  EXPECT_EQ(100000, histogram->max());
+  ASSERT_NE(nullptr, tracer->pause_histogram(kMarkCompactIndex));
+  EXPECT_EQ(2, tracer->pause_histogram(kMarkCompactIndex)->count());
+  EXPECT_EQ(nullptr, tracer->pause_histogram(GCTracer::Scope::MC_SWEEP));
+  EXPECT_STREQ("V8.GC_MC_MARK",
+               GCTracer::PauseHistogramName(GCTracer::Scope::MC_MARK));
+  EXPECT_STREQ("V8.GCCompactor",
+               GCTracer::PauseHistogramName(kMarkCompactIndex));
+
+  tracer->ResetPauseHistograms();
+  EXPECT_EQ(0, tracer->pause_histogram(GCTracer::Scope::MC_MARK)->count());
+}
+
 TEST_F(GCTracerTest, IncrementalMarkingDetails) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
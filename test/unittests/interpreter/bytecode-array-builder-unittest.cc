@@ -172,6 +172,10 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
       .LoadLiteral(Smi::FromInt(6))
       .BinaryOperation(Token::Value::SAR, reg, 6);
 
+  // Emit superinstruction of Ldar followed by binary operation.
+  builder.LoadAccumulatorWithRegister(other)
+      .BinaryOperation(Token::Value::ADD, reg, 1);
+
   // Emit count operatior invocations
   builder.CountOperation(Token::Value::ADD, 1)
       .CountOperation(Token::Value::SUB, 1);
@@ -429,6 +433,11 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
     scorecard[Bytecodes::ToByte(Bytecode::kTestNull)] = 1;
   }
 
+  if (!FLAG_ignition_peephole || !FLAG_ignition_superinstructions) {
+    // Insert entries for superinstructions only emitted on request.
+    scorecard[Bytecodes::ToByte(Bytecode::kAddRegisters)] = 1;
+  }
+
   // Check return occurs at the end and only once in the BytecodeArray.
   CHECK_EQ(final_bytecode, Bytecode::kReturn);
   CHECK_EQ(scorecard[Bytecodes::ToByte(final_bytecode)], 1);
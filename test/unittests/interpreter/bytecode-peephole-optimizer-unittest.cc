@@ -404,6 +404,42 @@ TEST_F(BytecodePeepholeOptimizerTest, MergeLdaZeroWithBinaryOp) {
   }
 }
 
+TEST_F(BytecodePeepholeOptimizerTest, MergeLdarWithAdd) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = true;
+  BytecodeSourceInfo source_info(3, true);
+  uint32_t rhs_operand = Register(1).ToOperand();
+  uint32_t lhs_operand = Register(0).ToOperand();
+  uint32_t idx_operand = 1;
+  BytecodeNode first(Bytecode::kLdar, rhs_operand, source_info);
+  BytecodeNode second(Bytecode::kAdd, lhs_operand, idx_operand);
+  optimizer()->Write(&first);
+  optimizer()->Write(&second);
+  Flush();
+  CHECK_EQ(write_count(), 1);
+  CHECK_EQ(last_written().bytecode(), Bytecode::kAddRegisters);
+  CHECK_EQ(last_written().operand_count(), 3);
+  CHECK_EQ(last_written().operand(0), lhs_operand);
+  CHECK_EQ(last_written().operand(1), rhs_operand);
+  CHECK_EQ(last_written().operand(2), idx_operand);
+  CHECK_EQ(last_written().source_info(), source_info);
+  FLAG_ignition_superinstructions = old_flag;
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, NotMergingLdarWithAdd) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = false;
+  BytecodeNode first(Bytecode::kLdar, Register(1).ToOperand());
+  BytecodeNode second(Bytecode::kAdd, Register(0).ToOperand(), 1);
+  optimizer()->Write(&first);
+  optimizer()->Write(&second);
+  CHECK_EQ(last_written(), first);
+  Flush();
+  CHECK_EQ(last_written(), second);
+  CHECK_EQ(write_count(), 2);
+  FLAG_ignition_superinstructions = old_flag;
+}
+
 TEST_F(BytecodePeepholeOptimizerTest, MergeLdaNullOrUndefinedWithCompareOp) {
   Bytecode first_bytecodes[] = {Bytecode::kLdaUndefined, Bytecode::kLdaNull};
 
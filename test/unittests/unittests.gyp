@@ -156,6 +156,7 @@
       'compiler/mips64/instruction-selector-mips64-unittest.cc',
     ],
     'unittests_sources_x64': [  ### gcmole(arch:x64) ###
+      'compiler/x64/instruction-scheduler-x64-unittest.cc',
       'compiler/x64/instruction-selector-x64-unittest.cc',
     ],
     'unittests_sources_ppc': [  ### gcmole(arch:ppc) ###
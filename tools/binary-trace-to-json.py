@@ -0,0 +1,223 @@
+#!/usr/bin/env python
+#
+# Copyright 2017 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Converts a binary trace to the JSON trace event format.
+
+Binary traces are written by v8::platform::tracing::TraceWriter::
+CreateBinaryTraceWriter, the format is described at BinaryTraceWriter in
+src/libplatform/tracing/trace-writer.h. The output is the same as that of
+the JSON trace writer for the same events.
+
+Usage: binary-trace-to-json.py <binary-trace> [<json-output>]
+"""
+
+import math
+import struct
+import sys
+
+
+MAGIC = b"V8TR"
+VERSION = 2
+
+END_RECORD = 0
+STRING_RECORD = 1
+EVENT_RECORD = 2
+
+TRACE_EVENT_FLAG_HAS_ID = 1 << 1
+
+TRACE_VALUE_TYPE_BOOL = 1
+TRACE_VALUE_TYPE_UINT = 2
+TRACE_VALUE_TYPE_INT = 3
+TRACE_VALUE_TYPE_DOUBLE = 4
+TRACE_VALUE_TYPE_POINTER = 5
+TRACE_VALUE_TYPE_STRING = 6
+TRACE_VALUE_TYPE_COPY_STRING = 7
+TRACE_VALUE_TYPE_CONVERTABLE = 8
+
+
+class TraceReader(object):
+  def __init__(self, data):
+    self.data = bytearray(data)
+    self.pos = 0
+    # Strings are numbered from 1, 0 stands for null.
+    self.strings = [None]
+
+  def ReadByte(self):
+    if self.pos >= len(self.data):
+      raise ValueError("Truncated trace")
+    value = self.data[self.pos]
+    self.pos += 1
+    return value
+
+  def ReadVarint(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.ReadByte()
+      result |= (byte & 0x7f) << shift
+      if byte < 0x80:
+        return result
+      shift += 7
+
+  def ReadZigzag(self):
+    value = self.ReadVarint()
+    return (value >> 1) ^ -(value & 1)
+
+  def ReadBytes(self, length):
+    if self.pos + length > len(self.data):
+      raise ValueError("Truncated trace")
+    value = bytes(self.data[self.pos:self.pos + length])
+    self.pos += length
+    return value
+
+  def ReadString(self):
+    return self.strings[self.ReadVarint()]
+
+  def ReadInlineString(self):
+    # Inline strings are prefixed with their length plus one, 0 is null.
+    length = self.ReadVarint()
+    if length == 0:
+      return None
+    return self.ReadBytes(length - 1)
+
+
+def ReadEvents(data):
+  """Yields the events of a binary trace as dictionaries."""
+  reader = TraceReader(data)
+  if reader.ReadBytes(len(MAGIC)) != MAGIC:
+    raise ValueError("Not a binary trace")
+  version = reader.ReadVarint()
+  if version != VERSION:
+    raise ValueError("Unsupported trace version %d" % version)
+  ts = 0
+  tts = 0
+  while True:
+    tag = reader.ReadByte()
+    if tag == END_RECORD:
+      return
+    elif tag == STRING_RECORD:
+      reader.strings.append(reader.ReadBytes(reader.ReadVarint()))
+    elif tag == EVENT_RECORD:
+      event = {}
+      event["ph"] = chr(reader.ReadByte())
+      event["pid"] = reader.ReadVarint()
+      event["tid"] = reader.ReadVarint()
+      ts += reader.ReadZigzag()
+      tts += reader.ReadZigzag()
+      event["ts"] = ts
+      event["tts"] = tts
+      event["dur"] = reader.ReadVarint()
+      event["tdur"] = reader.ReadVarint()
+      event["cat"] = reader.ReadString()
+      event["name"] = reader.ReadString()
+      flags = reader.ReadVarint()
+      if flags & TRACE_EVENT_FLAG_HAS_ID:
+        event["scope"] = reader.ReadString()
+        event["id"] = reader.ReadVarint()
+      args = []
+      for i in range(reader.ReadVarint()):
+        name = reader.ReadString()
+        arg_type = reader.ReadByte()
+        args.append((name, arg_type, ReadArgValue(reader, arg_type)))
+      event["args"] = args
+      yield event
+    else:
+      raise ValueError("Unknown record %d" % tag)
+
+
+def ReadArgValue(reader, arg_type):
+  if arg_type == TRACE_VALUE_TYPE_BOOL:
+    return reader.ReadByte() != 0
+  if arg_type in (TRACE_VALUE_TYPE_UINT, TRACE_VALUE_TYPE_POINTER):
+    return reader.ReadVarint()
+  if arg_type == TRACE_VALUE_TYPE_INT:
+    return reader.ReadZigzag()
+  if arg_type == TRACE_VALUE_TYPE_DOUBLE:
+    return struct.unpack("<d", reader.ReadBytes(8))[0]
+  if arg_type in (TRACE_VALUE_TYPE_STRING, TRACE_VALUE_TYPE_COPY_STRING,
+                  TRACE_VALUE_TYPE_CONVERTABLE):
+    return reader.ReadInlineString()
+  raise ValueError("Unknown argument type %d" % arg_type)
+
+
+def EscapeString(s):
+  """Quotes bytes like WriteJSONStringToStream in trace-writer.cc."""
+  escapes = {0x08: "\\b", 0x0c: "\\f", 0x0a: "\\n", 0x0d: "\\r",
+             0x09: "\\t", 0x22: "\\\"", 0x5c: "\\\\"}
+  out = []
+  for c in bytearray(s):
+    out.append(escapes.get(c, chr(c)))
+  return "\"" + "".join(out) + "\""
+
+
+def FormatArgValue(arg_type, value):
+  """Formats a value like JSONTraceWriter::AppendArgValue."""
+  if arg_type == TRACE_VALUE_TYPE_BOOL:
+    return "true" if value else "false"
+  if arg_type in (TRACE_VALUE_TYPE_UINT, TRACE_VALUE_TYPE_INT):
+    return "%d" % value
+  if arg_type == TRACE_VALUE_TYPE_DOUBLE:
+    if math.isnan(value):
+      return "\"NaN\""
+    if math.isinf(value):
+      return "\"-Infinity\"" if value < 0 else "\"Infinity\""
+    real = "%g" % value
+    if "." not in real and "e" not in real and "E" not in real:
+      real += ".0"
+    return real
+  if arg_type == TRACE_VALUE_TYPE_POINTER:
+    return "\"0x%x\"" % value if value else "\"0\""
+  if arg_type == TRACE_VALUE_TYPE_CONVERTABLE:
+    return value.decode("latin-1")
+  if value is None:
+    return "\"NULL\""
+  return EscapeString(value)
+
+
+def Decode(s):
+  return s.decode("latin-1")
+
+
+def WriteJSON(events, out):
+  out.write("{\"traceEvents\":[")
+  first = True
+  for event in events:
+    if not first:
+      out.write(",")
+    first = False
+    out.write("{\"pid\":%d,\"tid\":%d,\"ts\":%d,\"tts\":%d,\"ph\":\"%s\","
+              "\"cat\":\"%s\",\"name\":\"%s\",\"dur\":%d,\"tdur\":%d" %
+              (event["pid"], event["tid"], event["ts"], event["tts"],
+               event["ph"], Decode(event["cat"]), Decode(event["name"]),
+               event["dur"], event["tdur"]))
+    if "id" in event:
+      if event["scope"] is not None:
+        out.write(",\"scope\":\"%s\"" % Decode(event["scope"]))
+      out.write(",\"id\":\"0x%x\"" % event["id"])
+    out.write(",\"args\":{")
+    out.write(",".join("\"%s\":%s" % (Decode(name),
+                                      FormatArgValue(arg_type, value))
+                       for (name, arg_type, value) in event["args"]))
+    out.write("}}")
+  out.write("]}")
+
+
+def Main(argv):
+  if len(argv) not in (2, 3):
+    print("Usage: %s <binary-trace> [<json-output>]" % argv[0])
+    return 1
+  with open(argv[1], "rb") as f:
+    events = ReadEvents(f.read())
+    if len(argv) == 3:
+      with open(argv[2], "w") as out:
+        WriteJSON(events, out)
+    else:
+      WriteJSON(events, sys.stdout)
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(Main(sys.argv))
@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+#
+# Copyright 2017 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Converts a binary heap snapshot to the JSON heap snapshot format.
+
+Binary snapshots are written by v8::HeapProfiler::TakeHeapSnapshotToStream,
+the format is described at HeapSnapshotBinaryWriter in
+src/profiler/heap-snapshot-generator.h. The output is the same as that of
+v8::HeapSnapshot::Serialize for the snapshot, without allocation traces.
+
+Usage: heap-snapshot-to-json.py <binary-snapshot> [<json-output>]
+"""
+
+import sys
+
+
+MAGIC = b"V8HS"
+VERSION = 1
+
+END_RECORD = 0
+STRING_RECORD = 1
+EDGE_RECORD = 2
+NODE_RECORD = 3
+
+# HeapGraphEdge types whose name_or_index is an index rather than a string.
+ELEMENT_EDGE = 1
+HIDDEN_EDGE = 4
+
+NODE_FIELDS_COUNT = 6
+
+META = (
+    '"meta":{"node_fields":["type","name","id","self_size","edge_count",'
+    '"trace_node_id"],"node_types":[["hidden","array","string","object",'
+    '"code","closure","regexp","number","native","synthetic",'
+    '"concatenated string","sliced string"],"string","number","number",'
+    '"number","number","number"],"edge_fields":["type","name_or_index",'
+    '"to_node"],"edge_types":[["context","element","property","internal",'
+    '"hidden","shortcut","weak"],"string_or_number","node"],'
+    '"trace_function_info_fields":["function_id","name","script_name",'
+    '"script_id","line","column"],"trace_node_fields":["id",'
+    '"function_info_index","count","size","children"],"sample_fields":'
+    '["timestamp_us","last_assigned_id"]}')
+
+
+class SnapshotReader(object):
+  def __init__(self, data):
+    self.data = bytearray(data)
+    self.pos = 0
+
+  def ReadByte(self):
+    if self.pos >= len(self.data):
+      raise ValueError("Truncated snapshot")
+    value = self.data[self.pos]
+    self.pos += 1
+    return value
+
+  def ReadVarint(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.ReadByte()
+      result |= (byte & 0x7f) << shift
+      if byte < 0x80:
+        return result
+      shift += 7
+
+  def ReadZigzag(self):
+    value = self.ReadVarint()
+    return (value >> 1) ^ -(value & 1)
+
+  def ReadBytes(self, length):
+    if self.pos + length > len(self.data):
+      raise ValueError("Truncated snapshot")
+    value = bytes(self.data[self.pos:self.pos + length])
+    self.pos += length
+    return value
+
+
+def ReadSnapshot(data):
+  """Returns the strings, nodes and edges of a binary snapshot."""
+  reader = SnapshotReader(data)
+  if reader.ReadBytes(len(MAGIC)) != MAGIC:
+    raise ValueError("Not a binary heap snapshot")
+  version = reader.ReadVarint()
+  if version != VERSION:
+    raise ValueError("Unsupported snapshot version %d" % version)
+  # Strings are indexed by their id, which starts at 1.
+  strings = [None]
+  nodes = []
+  edges = []
+  from_index = 0
+  while True:
+    tag = reader.ReadByte()
+    if tag == END_RECORD:
+      break
+    elif tag == STRING_RECORD:
+      strings.append(reader.ReadBytes(reader.ReadVarint()))
+    elif tag == EDGE_RECORD:
+      edge_type = reader.ReadVarint()
+      from_index += reader.ReadZigzag()
+      name_or_index = reader.ReadVarint()
+      to_index = reader.ReadVarint()
+      edges.append((from_index, edge_type, name_or_index, to_index))
+    elif tag == NODE_RECORD:
+      nodes.append(tuple(reader.ReadVarint() for i in range(5)))
+    else:
+      raise ValueError("Unknown record %d" % tag)
+  return strings, nodes, edges
+
+
+def EscapeString(s):
+  """Escapes UTF-8 bytes like HeapSnapshotJSONSerializer::SerializeString."""
+  s = bytearray(s)
+  out = []
+  i = 0
+  while i < len(s):
+    c = s[i]
+    i += 1
+    if c == 0x08:
+      out.append("\\b")
+    elif c == 0x0c:
+      out.append("\\f")
+    elif c == 0x0a:
+      out.append("\\n")
+    elif c == 0x0d:
+      out.append("\\r")
+    elif c == 0x09:
+      out.append("\\t")
+    elif c == 0x22 or c == 0x5c:
+      out.append("\\" + chr(c))
+    elif 31 < c < 128:
+      out.append(chr(c))
+    elif c <= 31:
+      out.append("\\u%04X" % c)
+    else:
+      # Convert UTF-8 into \u UTF-16 literal, keeping the low 16 bits.
+      if c >= 0xf0:
+        length, value = 4, c & 0x07
+      elif c >= 0xe0:
+        length, value = 3, c & 0x0f
+      elif c >= 0xc0:
+        length, value = 2, c & 0x1f
+      else:
+        length = 0
+      trail = s[i:i + length - 1]
+      if length and len(trail) == length - 1 and \
+         all(0x80 <= t < 0xc0 for t in trail):
+        for t in trail:
+          value = (value << 6) | (t & 0x3f)
+        out.append("\\u%04X" % (value & 0xffff))
+        i += length - 1
+      else:
+        out.append("?")
+  return "".join(out)
+
+
+def WriteJSON(strings, nodes, edges, out):
+  # Group the edges by node, keeping their order within a node.
+  edges_by_node = [[] for node in nodes]
+  for edge in edges:
+    edges_by_node[edge[0]].append(edge)
+
+  # Renumber the strings in the order of their first use in the output.
+  json_string_ids = {}
+  json_strings = []
+
+  def GetStringId(string_id):
+    s = strings[string_id]
+    if s not in json_string_ids:
+      json_strings.append(s)
+      json_string_ids[s] = len(json_strings)
+    return json_string_ids[s]
+
+  out.write('{"snapshot":{')
+  out.write(META)
+  out.write(',"node_count":%d,"edge_count":%d,"trace_function_count":0' %
+            (len(nodes), len(edges)))
+  out.write('},\n"nodes":[')
+  for index, (node_type, name, node_id, self_size, trace_node_id) in \
+      enumerate(nodes):
+    out.write("%s%d,%d,%d,%d,%d,%d\n" %
+              ("," if index else "", node_type, GetStringId(name), node_id,
+               self_size, len(edges_by_node[index]), trace_node_id))
+  out.write('],\n"edges":[')
+  first_edge = True
+  for node_edges in edges_by_node:
+    for (from_index, edge_type, name_or_index, to_index) in node_edges:
+      if edge_type not in (ELEMENT_EDGE, HIDDEN_EDGE):
+        name_or_index = GetStringId(name_or_index)
+      out.write("%s%d,%d,%d\n" %
+                ("" if first_edge else ",", edge_type, name_or_index,
+                 to_index * NODE_FIELDS_COUNT))
+      first_edge = False
+  out.write('],\n"trace_function_infos":[],\n"trace_tree":[],\n'
+            '"samples":[],\n"strings":["<dummy>"')
+  for s in json_strings:
+    out.write(',\n"%s"' % EscapeString(s))
+  out.write("]}")
+
+
+def Main(argv):
+  if len(argv) not in (2, 3):
+    print("Usage: %s <binary-snapshot> [<json-output>]" % argv[0])
+    return 1
+  with open(argv[1], "rb") as f:
+    strings, nodes, edges = ReadSnapshot(f.read())
+  if len(argv) == 3:
+    with open(argv[2], "w") as out:
+      WriteJSON(strings, nodes, edges, out)
+  else:
+    WriteJSON(strings, nodes, edges, sys.stdout)
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(Main(sys.argv))
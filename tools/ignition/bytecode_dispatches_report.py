@@ -44,6 +44,14 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the 10 bytecode pairs that are the best candidates for fusing into
+  # superinstructions, with the share of dispatches each one would save
+  $ tools/ignition/bytecode_dispatches_report.py -u
+
+  # Print the reduction in dispatches of data.json relative to base.json,
+  # e.g. from runs with and without --ignition-superinstructions
+  $ tools/ignition/bytecode_dispatches_report.py -b base.json data.json
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
@@ -125,6 +133,53 @@ def print_top_dispatch_sources_and_destinations(dispatches_table, bytecode,
     print "{:>12d}\t{:>5.1f}%\t{}".format(counter, ratio * 100, destination_name)
 
 
+def count_total_dispatches(dispatches_table):
+  return sum(sum(itervalues(counters_from_source))
+             for counters_from_source in itervalues(dispatches_table))
+
+
+def find_superinstruction_candidates(dispatches_table, top_count):
+  # Fusing a pair saves one dispatch per occurrence. The peephole optimizer
+  # fuses pairs left to right, so a pair that chains with an already selected
+  # one (its source is a selected destination or vice versa) would compete
+  # for the same occurrences and is skipped.
+  total = count_total_dispatches(dispatches_table)
+  candidates = []
+  sources = set()
+  destinations = set()
+  pairs = find_top_bytecode_dispatch_pairs(
+      dispatches_table, sum(len(d) for d in itervalues(dispatches_table)))
+  for source, destination, counter in pairs:
+    if len(candidates) == top_count:
+      break
+    if source in destinations or destination in sources:
+      continue
+    sources.add(source)
+    destinations.add(destination)
+    candidates.append((source, destination, counter,
+                       float(counter) / total if total else 0.0))
+  return candidates
+
+
+def print_superinstruction_candidates(dispatches_table, top_count):
+  candidates = find_superinstruction_candidates(dispatches_table, top_count)
+  print "Top {} superinstruction candidates:".format(top_count)
+  saved = 0.0
+  for source, destination, counter, ratio in candidates:
+    saved += ratio
+    print "{:>12d}\t{:>5.1f}%\t{:>5.1f}%\t{} + {}".format(
+        counter, ratio * 100, saved * 100, source, destination)
+
+
+def print_dispatches_reduction(dispatches_table, baseline_table):
+  total = count_total_dispatches(dispatches_table)
+  baseline_total = count_total_dispatches(baseline_table)
+  print "Dispatches: {} (baseline {})".format(total, baseline_total)
+  if baseline_total:
+    reduction = 1.0 - float(total) / baseline_total
+    print "Reduction: {:.1f}%".format(reduction * 100)
+
+
 def build_counters_matrix(dispatches_table):
   labels = sorted(dispatches_table.keys())
 
@@ -204,12 +259,22 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--superinstruction-candidates", "-u",
+    action="store_true",
+    help="print the bytecode pairs that would save most dispatches if fused"
+  )
+  command_line_parser.add_argument(
+    "--baseline", "-b",
+    metavar="<baseline filename>",
+    help="print the reduction in dispatches relative to the given counters"
+  )
   command_line_parser.add_argument(
     "--top-entries-count", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -u or -f (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
@@ -266,6 +331,13 @@ def main():
       figure.set_size_inches(program_options.plot_size,
                              program_options.plot_size)
       pyplot.savefig(program_options.output_filename)
+  elif program_options.baseline:
+    with open(program_options.baseline) as stream:
+      baseline_table = json.load(stream)
+    print_dispatches_reduction(dispatches_table, baseline_table)
+  elif program_options.superinstruction_candidates:
+    print_superinstruction_candidates(
+      dispatches_table, program_options.top_entries_count)
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_entries_count)
@@ -60,3 +60,20 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_find_superinstruction_candidates(self):
+    candidates = bdr.find_superinstruction_candidates({
+      "a": {"b": 50, "c": 5},
+      "b": {"a":  1, "c": 40},
+      "c": {"a":  4}
+    }, 10)
+    self.assertListEqual(candidates, [
+      ("a", "b", 50, 0.5),
+      ("a", "c", 5, 0.05)
+    ])
+
+  def test_count_total_dispatches(self):
+    self.assertEqual(bdr.count_total_dispatches({
+      "a": {"a": 10, "b":  8},
+      "b": {"c":  4}
+    }), 22)